@@ -1,788 +1,1463 @@
 #include "Toast.h"
+#include "ToastConfig_p.h"
+#include "ToastTrace.h"
 #include <algorithm>
+#include <array>
+#include <QApplication>
 #include <QCloseEvent>
+#include <QDateTime>
 #include <QDebug>
 #include <QFile>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QGuiApplication>
 #include <QHBoxLayout>
+#include <QPainterPath>
+#include <QPlainTextEdit>
 #include <QPropertyAnimation>
 #include <QPushButton>
+#include <QStyle>
 #include <QVBoxLayout>
+#include <QWindow>
 #include <QtMath>
 
-const int ToastGlobalConfig::UpdatePositionDuration = 200;
-const int ToastGlobalConfig::DurationBarUpdateInterval = 5;
-const int ToastGlobalConfig::DropShadowSize = 5;
-const QColor ToastGlobalConfig::SuccessAccentColor = QColor(QStringLiteral("#3e9141ff"));
-const QColor ToastGlobalConfig::WarningAccentColor = QColor(QStringLiteral("#E8B849"));
-const QColor ToastGlobalConfig::ErrorAccentColor = QColor(QStringLiteral("#BA2626"));
-const QColor ToastGlobalConfig::InformationAccentColor = QColor(QStringLiteral("#007FFF"));
-const QColor ToastGlobalConfig::DefaultAccentColor = QColor(QStringLiteral("#5C5C5C"));
-const QColor ToastGlobalConfig::DefaultBackgroundColor = QColor(QStringLiteral("#E7F4F9"));
-const QColor ToastGlobalConfig::DefaultTitleColor = QColor(QStringLiteral("#000000"));
-const QColor ToastGlobalConfig::DefaultTextColor = QColor(QStringLiteral("#5C5C5C"));
-const QColor ToastGlobalConfig::DefaultIconSeparatorColor = QColor(QStringLiteral("#D9D9D9"));
-const QColor ToastGlobalConfig::DefaultCloseButtonIconColor = QColor(QStringLiteral("#000000"));
-const QColor ToastGlobalConfig::DefaultBackgroundColorDark = QColor(QStringLiteral("#292929"));
-const QColor ToastGlobalConfig::DefaultTitleColorDark = QColor(QStringLiteral("#FFFFFF"));
-const QColor ToastGlobalConfig::DefaultTextColorDark = QColor(QStringLiteral("#D0D0D0"));
-const QColor ToastGlobalConfig::DefaultIconSeparatorColorDark = QColor(QStringLiteral("#585858"));
-const QColor ToastGlobalConfig::DefaultCloseButtonIconColorDark = QColor(QStringLiteral("#C9C9C9"));
-
-ToastGlobalConfig &ToastGlobalConfig::instance() noexcept
-{
-    static ToastGlobalConfig s_instance;
-    return s_instance;
+namespace {
+constexpr int PaletteModeMaxBorderRadius = 32;
+
+/**
+ * @brief Palette 模式下的应用级样式表：颜色取自各控件的调色板，圆角由动态属性匹配。
+ *        只构建一次，并且只向应用程序样式表追加一次，因此 Qt 样式引擎只需解析一次。
+ */
+const QString &paletteModeStyleSheet()
+{
+    static const QString s_styleSheet = []() {
+        QString sheet = QStringLiteral(
+            "/* qt-toast palette mode */"
+            "#toast-duration-bar-container { background: transparent; }"
+            "#toast-notification { background: palette(window); }"
+            "#toast-duration-bar { background: palette(window); }"
+            "#toast-duration-bar-chunk { background: palette(window); }"
+            "#toast-icon-separator { background: palette(window); }"
+            "#toast-title, #toast-text { color: palette(window-text); }"
+            "#toast-action-button {"
+            "    background-color: palette(button);"
+            "    color: palette(button-text);"
+            "    border: 1px solid palette(dark);"
+            "    border-radius: 4px;"
+            "    padding: 4px 12px;"
+            "}"
+            "#toast-action-button:hover { background-color: palette(midlight); }"
+            "#toast-action-button:pressed { background-color: palette(shadow); }");
+        for (int radius = 0; radius <= PaletteModeMaxBorderRadius; radius++) {
+            sheet += QString(
+                         "#toast-notification[toastRadius=\"%1\"],"
+                         "#toast-duration-bar[toastRadius=\"%1\"] { border-radius: %1px; }"
+                         "#toast-duration-bar-chunk[toastRadius=\"%1\"] {"
+                         "    border-bottom-left-radius: %1px; }"
+                         "#toast-duration-bar-chunk[toastRadius=\"%1\"][toastInfinite=\"true\"] {"
+                         "    border-bottom-right-radius: %1px; }")
+                         .arg(radius);
+        }
+        return sheet;
+    }();
+    return s_styleSheet;
 }
 
-int ToastGlobalConfig::maximumOnScreen() const noexcept
+/**
+ * @brief 把 Toast 的基础样式表（Palette 模式下再加上调色板规则）作为片段追加到应用程序样式表。
+ *        所有 Toast 共享这一份规则，基础样式表重新加载时只替换片段，样式引擎只需解析一次，
+ *        而不是每个 Toast 各自 setStyleSheet 并各自解析。
+ */
+void installToastStyleSheet()
 {
-    return m_maximumOnScreen;
+    auto *app = qobject_cast<QApplication *>(QCoreApplication::instance());
+    if (app == nullptr) {
+        return;
+    }
+    // 记录上一次追加的片段，基础样式表或样式模式变化时原位替换而不是重复追加
+    static QString s_installed;
+    const auto &config = ToastGlobalConfig::instance();
+    QString fragment = config.styleSheet();
+    if (config.styleMode() == ToastStyleMode::Palette) {
+        fragment += paletteModeStyleSheet();
+    } else {
+        fragment += QStringLiteral("#toast-duration-bar-container { background: transparent; }");
+    }
+    QString appStyleSheet = app->styleSheet();
+    if (!s_installed.isEmpty() && appStyleSheet.contains(s_installed)) {
+        if (s_installed == fragment) {
+            return;
+        }
+        appStyleSheet.replace(s_installed, fragment);
+    } else {
+        appStyleSheet += fragment;
+    }
+    s_installed = fragment;
+    app->setStyleSheet(appStyleSheet);
+}
+} // namespace
+
+namespace {
+constexpr int LagSampleInterval = 100; ///< 事件循环延迟的采样间隔（毫秒）
+constexpr double LagSmoothing = 0.25;  ///< 延迟指数平滑系数，越大对突发延迟越敏感
+constexpr std::array<int, 5> DropShadowLayerAlphas{3, 5, 6, 9, 10}; ///< 与 toast.css 中各阴影层一致
+constexpr int DropShadowLayerRadius = 8; ///< 与 toast.css 中阴影层的圆角一致
+constexpr int VisibilityPollInterval = 1000; ///< 应用非活动期间轮询窗口可见性的间隔（毫秒）
+constexpr int SummaryTitleCount = 3;         ///< 汇总 Toast 最多列出的标题数
+constexpr int DefaultReplayInterval = 2000;  ///< 免打扰结束后限速重放的默认间隔（毫秒）
+constexpr int FullTextTitleLimit = 80;       ///< 全文窗口标题的最大字符数
+constexpr int FullTextViewerWidth = 640;     ///< 全文窗口的初始宽度
+constexpr int FullTextViewerHeight = 480;    ///< 全文窗口的初始高度
+constexpr int FullTextBlockLength = 4096;    ///< 全文窗口中单个段落的最大字符数
+
+/**
+ * @brief 在超长的行中每隔 FullTextBlockLength 个字符插入换行，使每个段落都有上限。
+ *        QPlainTextEdit 按段落惰性排版，一个无换行的数 MB 文本会在打开时一次排完。
+ */
+QString boundedBlocks(const QString &text)
+{
+    QString bounded;
+    bounded.reserve(text.size() + text.size() / FullTextBlockLength);
+    qsizetype blockStart = 0;
+    for (qsizetype i = 0; i < text.size(); i++) {
+        const QChar c = text.at(i);
+        if (c == QLatin1Char('\n')) {
+            blockStart = i + 1;
+        } else if (i - blockStart >= FullTextBlockLength && !c.isLowSurrogate()) {
+            // 不拆开代理对
+            bounded.append(QLatin1Char('\n'));
+            blockStart = i;
+        }
+        bounded.append(c);
+    }
+    return bounded;
 }
 
-ToastGlobalConfig &ToastGlobalConfig::setMaximumOnScreen(int maximum) noexcept
+/**
+ * @brief 将进度 Toast 的结束状态写入配置，保留进度条的开关。
+ */
+void applyOutcome(ToastConfig &config, const ToastOutcome &outcome)
 {
-    m_maximumOnScreen = maximum;
-    return *this;
+    // 进度条是否存在已经决定了布局，不随预设改变
+    const bool durationBarShown = config.showDurationBar();
+    config.setPreset(outcome.preset)
+        .setShowDurationBar(durationBarShown)
+        .setDuration(outcome.duration);
+    if (!outcome.text.isEmpty()) {
+        config.setText(outcome.text);
+    }
 }
 
-int ToastGlobalConfig::spacing() const noexcept
+quint64 nextToastId() noexcept
 {
-    return m_spacing;
+    static quint64 s_nextId = 0;
+    return ++s_nextId;
 }
 
-ToastGlobalConfig &ToastGlobalConfig::setSpacing(int spacing) noexcept
+/**
+ * @brief 覆盖整个屏幕的透明窗口，以子控件形式承载该屏幕上的所有 Toast。
+ *        窗口遮罩只覆盖 Toast 所在区域，空白处的鼠标事件会穿透到下方窗口。
+ */
+class ToastOverlay final : public QWidget
 {
-    m_spacing = spacing;
-    return *this;
-}
+public:
+    explicit ToastOverlay(QScreen *screen)
+        : QWidget(
+              nullptr,
+              Qt::WindowType::Tool | Qt::WindowType::FramelessWindowHint
+                  | Qt::WindowType::WindowStaysOnTopHint | Qt::WindowType::WindowDoesNotAcceptFocus)
+    {
+        setAttribute(Qt::WidgetAttribute::WA_TranslucentBackground);
+        setAttribute(Qt::WidgetAttribute::WA_ShowWithoutActivating);
+        setFocusPolicy(Qt::FocusPolicy::NoFocus);
+        setGeometry(screen->geometry());
+        connect(screen, &QScreen::geometryChanged, this, [this](const QRect &geometry) {
+            setGeometry(geometry);
+            ToastManager::instance().updateAllPositions();
+        });
+    }
 
-int ToastGlobalConfig::offsetY() const noexcept
-{
-    return m_offsetY;
-}
+    void attach(Toast *toast)
+    {
+        toast->setParent(this);
+        toast->installEventFilter(this);
+        if (!isVisible()) {
+            // 先用极小的遮罩显示，避免 Toast 尚未布局时整个屏幕拦截鼠标事件
+            m_mask = QRegion(0, 0, 1, 1);
+            setMask(m_mask);
+            show();
+        }
+    }
 
-int ToastGlobalConfig::offsetX() const noexcept
-{
-    return m_offsetX;
-}
+    void reserve(const QRect &rect)
+    {
+        if (m_mask.intersected(rect) == QRegion(rect)) {
+            return;
+        }
+        m_mask |= rect;
+        setMask(m_mask);
+    }
 
-ToastGlobalConfig &ToastGlobalConfig::setOffset(int x, int y) noexcept
-{
-    m_offsetX = x;
-    m_offsetY = y;
-    return *this;
-}
+    void scheduleRefresh()
+    {
+        if (m_refreshPending) {
+            return;
+        }
+        m_refreshPending = true;
+        QTimer::singleShot(0, this, [this]() { refreshMask(); });
+    }
 
-ToastGlobalConfig &ToastGlobalConfig::setOffsetX(int offsetX) noexcept
-{
-    m_offsetX = offsetX;
-    return *this;
-}
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        switch (event->type()) {
+        case QEvent::Show:
+        case QEvent::Hide:
+        case QEvent::Resize:
+            scheduleRefresh();
+            break;
+        default:
+            break;
+        }
+        return QWidget::eventFilter(watched, event);
+    }
 
-ToastGlobalConfig &ToastGlobalConfig::setOffsetY(int offsetY) noexcept
-{
-    m_offsetY = offsetY;
-    return *this;
-}
+private:
+    void refreshMask()
+    {
+        m_refreshPending = false;
+        QRegion region;
+        const auto toasts = findChildren<Toast *>(QString(), Qt::FindDirectChildrenOnly);
+        for (auto *toast : toasts) {
+            if (toast->isVisible()) {
+                region |= toast->geometry();
+            }
+        }
+        if (region.isEmpty()) {
+            // 没有 Toast 时隐藏，不留下拦截鼠标事件的窗口
+            hide();
+            return;
+        }
+        m_mask = region;
+        setMask(m_mask);
+    }
 
-bool ToastGlobalConfig::alwaysOnMainScreen() const noexcept
-{
-    return m_alwaysOnMainScreen;
-}
+    QRegion m_mask;
+    bool m_refreshPending{false};
+};
 
-ToastGlobalConfig &ToastGlobalConfig::setAlwaysOnMainScreen(bool enabled) noexcept
+/**
+ * @brief 监听 Embedded 模式宿主控件的尺寸变化，并重新排列其中的 Toast。作为宿主的子对象随其销毁。
+ */
+class ToastHostResizeFilter final : public QObject
 {
-    m_alwaysOnMainScreen = enabled;
-    return *this;
+public:
+    static void install(QWidget *host)
+    {
+        static const QString s_name = QStringLiteral("qt-toast-host-resize-filter");
+        if (host->findChild<QObject *>(s_name, Qt::FindDirectChildrenOnly) != nullptr) {
+            return;
+        }
+        auto *filter = new ToastHostResizeFilter(host);
+        filter->setObjectName(s_name);
+        host->installEventFilter(filter);
+    }
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        if (event->type() == QEvent::Resize) {
+            ToastManager::instance().updateAllPositions();
+        }
+        return QObject::eventFilter(watched, event);
+    }
+
+private:
+    explicit ToastHostResizeFilter(QObject *parent)
+        : QObject(parent)
+    {}
+};
+
+/**
+ * @brief 判断应用是否对用户不可见：被挂起或隐藏、没有屏幕，或者应用自身的窗口都已最小化、
+ *        不再暴露（被遮挡、不在当前虚拟桌面或被锁屏覆盖）。没有可见主窗口的托盘应用不算隐藏。
+ */
+bool isApplicationHidden()
+{
+    const Qt::ApplicationState state = QGuiApplication::applicationState();
+    if (state == Qt::ApplicationState::ApplicationHidden
+        || state == Qt::ApplicationState::ApplicationSuspended
+        || QGuiApplication::screens().isEmpty()) {
+        return true;
+    }
+    if (state == Qt::ApplicationState::ApplicationActive) {
+        return false;
+    }
+    // 桌面平台上最小化、切换虚拟桌面或锁屏通常只会使应用变为 Inactive
+    bool hasWindow = false;
+    const auto widgets = QApplication::topLevelWidgets();
+    for (QWidget *widget : widgets) {
+        const Qt::WindowType type = widget->windowType();
+        if ((type != Qt::WindowType::Window && type != Qt::WindowType::Dialog)
+            || qobject_cast<Toast *>(widget) != nullptr || !widget->isVisible()) {
+            continue;
+        }
+        hasWindow = true;
+        const QWindow *window = widget->windowHandle();
+        if (!widget->isMinimized() && (window == nullptr || window->isExposed())) {
+            return false;
+        }
+    }
+    return hasWindow;
 }
+} // namespace
 
-QScreen *ToastGlobalConfig::fixedScreen() const noexcept
+ToastHandle::ToastHandle(quint64 id) noexcept
+    : m_id(id)
+{}
+
+quint64 ToastHandle::id() const noexcept
 {
-    return m_fixedScreen;
+    return m_id;
 }
 
-ToastGlobalConfig &ToastGlobalConfig::setFixedScreen(QScreen *screen) noexcept
+bool ToastHandle::isValid() const noexcept
 {
-    m_fixedScreen = screen;
-    return *this;
+    return isQueued() || isScheduled() || toast() != nullptr;
 }
 
-ToastPosition ToastGlobalConfig::position() const noexcept
+bool ToastHandle::isQueued() const noexcept
 {
-    return m_position;
+    // 暂缓显示的 Toast 不在调度器队列中，但仍以条目形式等待
+    return m_id != 0 && ToastManager::instance().findQueued(m_id) != nullptr;
 }
 
-ToastGlobalConfig &ToastGlobalConfig::setPosition(ToastPosition position) noexcept
+bool ToastHandle::isScheduled() const noexcept
 {
-    m_position = position;
-    return *this;
+    return m_id != 0 && ToastManager::instance().m_scheduled.count(m_id) > 0;
 }
 
-QPixmap ToastConfig::getIconFromEnum(ToastIcon enumIcon) noexcept
+Toast *ToastHandle::toast() const noexcept
 {
-    if (enumIcon == ToastIcon::Success) {
-        return QPixmap(":/icons/success.png");
-    } else if (enumIcon == ToastIcon::Warning) {
-        return QPixmap(":/icons/warning.png");
-    } else if (enumIcon == ToastIcon::Error) {
-        return QPixmap(":/icons/error.png");
-    } else if (enumIcon == ToastIcon::Information) {
-        return QPixmap(":/icons/information.png");
-    } else if (enumIcon == ToastIcon::Close) {
-        return QPixmap(":/icons/close.png");
+    if (m_id == 0) {
+        return nullptr;
+    }
+    auto &manager = ToastManager::instance();
+    if (auto *toast = manager.findShown(m_id)) {
+        return toast;
+    }
+    if (auto *entry = manager.findQueued(m_id)) {
+        return entry->toast;
     }
-    return QPixmap();
+    return nullptr;
 }
 
-QImage ToastConfig::recolorImage(QImage image, const QColor &color) noexcept
+ToastConfig *ToastHandle::config() const noexcept
 {
-    // Loop through every pixel
-    for (int x = 0; x < image.width(); x++) {
-        for (int y = 0; y < image.height(); y++) {
-            // Get current color of the pixel
-            QColor currentColor = image.pixelColor(x, y);
-
-            // Replace the rgb values with rgb of new color and keep alpha the same
-            QColor newColor = QColor::fromRgba(
-                qRgba(color.red(), color.green(), color.blue(), currentColor.alpha()));
-            image.setPixelColor(x, y, newColor);
+    if (m_id == 0) {
+        return nullptr;
+    }
+    auto &manager = ToastManager::instance();
+    if (auto *entry = manager.findQueued(m_id)) {
+        if (entry->descriptor) {
+            return &entry->descriptor->config;
         }
+        return entry->toast ? &entry->toast->config() : nullptr;
     }
-    return image;
-}
-
-ToastConfig &ToastConfig::setPreset(ToastPreset preset) noexcept
-{
-    if (preset == ToastPreset::Success || preset == ToastPreset::SuccessDark) {
-        setIcon(ToastIcon::Success);
-        setIconColor(ToastGlobalConfig::SuccessAccentColor);
-        setDurationBarColor(ToastGlobalConfig::SuccessAccentColor);
-    } else if (preset == ToastPreset::Warning || preset == ToastPreset::WarningDark) {
-        setIcon(ToastIcon::Warning);
-        setIconColor(ToastGlobalConfig::WarningAccentColor);
-        setDurationBarColor(ToastGlobalConfig::WarningAccentColor);
-    } else if (preset == ToastPreset::Error || preset == ToastPreset::ErrorDark) {
-        setIcon(ToastIcon::Error);
-        setIconColor(ToastGlobalConfig::ErrorAccentColor);
-        setDurationBarColor(ToastGlobalConfig::ErrorAccentColor);
-    } else if (preset == ToastPreset::Information || preset == ToastPreset::InformationDark) {
-        setIcon(ToastIcon::Information);
-        setIconColor(ToastGlobalConfig::InformationAccentColor);
-        setDurationBarColor(ToastGlobalConfig::InformationAccentColor);
-    }
-
-    if (preset == ToastPreset::Success || preset == ToastPreset::Warning
-        || preset == ToastPreset::Error || preset == ToastPreset::Information) {
-        setBackgroundColor(ToastGlobalConfig::DefaultBackgroundColor);
-        setCloseButtonIconColor(ToastGlobalConfig::DefaultCloseButtonIconColor);
-        setIconSeparatorColor(ToastGlobalConfig::DefaultIconSeparatorColor);
-        setTitleColor(ToastGlobalConfig::DefaultTitleColor);
-        setTextColor(ToastGlobalConfig::DefaultTextColor);
-    } else if (
-        preset == ToastPreset::SuccessDark || preset == ToastPreset::WarningDark
-        || preset == ToastPreset::ErrorDark || preset == ToastPreset::InformationDark) {
-        setBackgroundColor(ToastGlobalConfig::DefaultBackgroundColorDark);
-        setCloseButtonIconColor(ToastGlobalConfig::DefaultCloseButtonIconColorDark);
-        setIconSeparatorColor(ToastGlobalConfig::DefaultIconSeparatorColorDark);
-        setTitleColor(ToastGlobalConfig::DefaultTitleColorDark);
-        setTextColor(ToastGlobalConfig::DefaultTextColorDark);
-    }
-    setShowDurationBar(true);
-    setShowIcon(true);
-    setShowIconSeparator(true);
-    setIconSeparatorWidth(2);
-    return *this;
+    if (auto *toast = manager.findShown(m_id)) {
+        return &toast->config();
+    }
+    auto it = manager.m_scheduled.find(m_id);
+    return it != manager.m_scheduled.end() ? &it->second.config : nullptr;
 }
 
-ToastConfig &ToastConfig::setDuration(int duration) noexcept
+void ToastHandle::close() const noexcept
 {
-    m_duration = duration;
-    return *this;
+    if (m_id == 0) {
+        return;
+    }
+    auto &manager = ToastManager::instance();
+    if (auto *toast = manager.findShown(m_id)) {
+        toast->hide();
+        return;
+    }
+    if (!manager.m_scheduler.cancel(m_id) && !manager.cancelDeferred(m_id)) {
+        manager.cancelScheduled(m_id);
+    }
 }
 
-ToastConfig &ToastConfig::setShowDurationBar(bool enabled) noexcept
+bool ToastHandle::operator==(const ToastHandle &other) const noexcept
 {
-    m_showDurationBar = enabled;
-    return *this;
+    return m_id == other.m_id;
 }
 
-ToastConfig &ToastConfig::setTitle(const QString &title) noexcept
+bool ToastHandle::operator!=(const ToastHandle &other) const noexcept
 {
-    m_title = title;
-    return *this;
+    return m_id != other.m_id;
 }
 
-ToastConfig &ToastConfig::setText(const QString &text) noexcept
+ToastManager &ToastManager::instance() noexcept
 {
-    m_text = text;
-    return *this;
+    static ToastManager s_instance;
+    return s_instance;
 }
 
-ToastConfig &ToastConfig::setIcon(const QPixmap &icon) noexcept
+ToastManager::ToastManager()
+    : m_scheduler(this)
 {
-    m_icon = icon;
-    return *this;
+    ToastGlobalConfig::instance().m_styleSheetChanged = [this]() { updateAllStyleSheets(); };
+    QObject::connect(qApp, &QGuiApplication::lastWindowClosed, []() {
+        ToastManager::instance().reset();
+    });
+    m_lagTimer.setTimerType(Qt::PreciseTimer);
+    m_lagTimer.setInterval(LagSampleInterval);
+    QObject::connect(&m_lagTimer, &QTimer::timeout, [this]() { sampleEventLoopLag(); });
+    m_visibilityTimer.setInterval(VisibilityPollInterval);
+    QObject::connect(&m_visibilityTimer, &QTimer::timeout, [this]() { updateSuspension(); });
+    QObject::connect(
+        qApp, &QGuiApplication::applicationStateChanged, [this](Qt::ApplicationState state) {
+            // 非活动时窗口可能随后才被最小化或遮挡，且不会再有状态变化通知，因此低频轮询
+            if (state == Qt::ApplicationState::ApplicationInactive) {
+                m_visibilityTimer.start();
+            } else {
+                m_visibilityTimer.stop();
+            }
+            updateSuspension();
+            // 休眠唤醒或解锁后应用重新变为活动状态，此时核对按系统时间定时的提交
+            if (state == Qt::ApplicationState::ApplicationActive) {
+                rescheduleWallDeadlines();
+            }
+        });
+    QObject::connect(qApp, &QGuiApplication::screenAdded, [this]() { updateSuspension(); });
+    // 屏幕在信号发出后才从列表中移除
+    QObject::connect(
+        qApp,
+        &QGuiApplication::screenRemoved,
+        qApp,
+        [this]() { updateSuspension(); },
+        Qt::QueuedConnection);
+    updateSuspension();
+    m_replayTimer.setInterval(DefaultReplayInterval);
+    QObject::connect(&m_replayTimer, &QTimer::timeout, [this]() { replayNext(); });
+    // 粗粒度定时器在长间隔下允许 5% 的误差，半小时后的提醒可能晚一分半钟
+    m_wheelTimer.setTimerType(Qt::PreciseTimer);
+    m_wheelTimer.setSingleShot(true);
+    QObject::connect(&m_wheelTimer, &QTimer::timeout, [this]() { presentScheduled(); });
+    m_progressTimer.setSingleShot(true);
+    QObject::connect(&m_progressTimer, &QTimer::timeout, [this]() { flushProgress(); });
 }
 
-ToastConfig &ToastConfig::setIcon(ToastIcon icon) noexcept
+ToastManager::~ToastManager()
 {
-    m_icon = getIconFromEnum(icon);
-    return *this;
+    reset();
 }
 
-ToastConfig &ToastConfig::setShowIcon(bool enabled) noexcept
+ToastManager &ToastManager::present(Toast *toast) noexcept
 {
-    m_showIcon = enabled;
+    if (toast == nullptr || exists(toast)) {
+        return *this;
+    }
+    syncPolicy();
+    m_metrics.recordPresented();
+    ToastTracer::instance().instant("present", toast->m_id);
+    ToastTracer::instance().begin("queue", toast->m_id);
+    enqueue(toast->m_id, QueuedToast{toast, std::nullopt, ToastMetrics::now()});
     return *this;
 }
 
-ToastConfig &ToastConfig::setIconSize(const QSize &size) noexcept
+ToastHandle ToastManager::present(ToastDescriptor descriptor) noexcept
 {
-    m_iconSize = size;
-    return *this;
+    ToastHandle handle(nextToastId());
+    syncPolicy();
+    m_metrics.recordPresented();
+    ToastTracer::instance().instant("present", handle.id());
+    ToastTracer::instance().begin("queue", handle.id());
+    enqueue(handle.id(), QueuedToast{nullptr, std::move(descriptor), ToastMetrics::now()});
+    return handle;
 }
 
-ToastConfig &ToastConfig::setShowIconSeparator(bool enabled) noexcept
+ToastHandle ToastManager::schedule(ToastDescriptor descriptor, std::chrono::milliseconds delay)
 {
-    m_showIconSeparator = enabled;
-    return *this;
+    ToastHandle handle(nextToastId());
+    ToastTracer::instance().begin("scheduled", handle.id());
+    m_scheduled.emplace(handle.id(), std::move(descriptor));
+    m_wheel.add(handle.id(), ToastMetrics::now() / 1000 + std::max<qint64>(0, delay.count()));
+    armScheduleTimer();
+    return handle;
 }
 
-ToastConfig &ToastConfig::setIconSeparatorWidth(int width) noexcept
+ToastHandle ToastManager::schedule(ToastDescriptor descriptor, const QDateTime &deadline)
 {
-    m_iconSeparatorWidth = width;
-    return *this;
+    const qint64 delay = QDateTime::currentDateTimeUtc().msecsTo(deadline);
+    ToastHandle handle = schedule(std::move(descriptor), std::chrono::milliseconds(delay));
+    // 时间轮按单调时钟计时，保留绝对时刻以便在系统时间调整或休眠唤醒后重新换算
+    if (deadline.isValid()) {
+        m_wallDeadlines.emplace(handle.id(), deadline.toMSecsSinceEpoch());
+    }
+    return handle;
 }
 
-ToastConfig &ToastConfig::setCloseButtonIcon(const QPixmap &icon) noexcept
+int ToastManager::scheduledCount() const noexcept
 {
-    m_closeButtonIcon = icon;
-    return *this;
+    return static_cast<int>(m_scheduled.size());
 }
 
-ToastConfig &ToastConfig::setCloseButtonIcon(ToastIcon icon) noexcept
+void ToastManager::presentScheduled()
 {
-    m_closeButtonIcon = getIconFromEnum(icon);
-    return *this;
+    const qint64 now = ToastMetrics::now() / 1000;
+    const qint64 wallNow = QDateTime::currentMSecsSinceEpoch();
+    const auto due = m_wheel.advance(now);
+    for (const quint64 id : due) {
+        auto wall = m_wallDeadlines.find(id);
+        if (wall != m_wallDeadlines.end()) {
+            // 系统时间被调回时，按系统时间尚未到期，按剩余时间重新放入时间轮
+            if (wall->second > wallNow && m_scheduled.count(id) > 0) {
+                m_wheel.add(id, now + (wall->second - wallNow));
+                continue;
+            }
+            m_wallDeadlines.erase(wall);
+        }
+        auto node = m_scheduled.extract(id);
+        if (node.empty()) {
+            continue;
+        }
+        ToastTracer::instance().end("scheduled", id);
+        syncPolicy();
+        m_metrics.recordPresented();
+        ToastTracer::instance().instant("present", id);
+        ToastTracer::instance().begin("queue", id);
+        enqueue(id, QueuedToast{nullptr, std::move(node.mapped()), ToastMetrics::now()});
+    }
+    armScheduleTimer();
 }
 
-ToastConfig &ToastConfig::setShowCloseButton(bool enabled) noexcept
+void ToastManager::armScheduleTimer()
 {
-    m_showCloseButton = enabled;
-    return *this;
+    const qint64 next = m_wheel.nextDeadline();
+    if (next < 0) {
+        m_wheelTimer.stop();
+        return;
+    }
+    const qint64 delay = std::clamp<qint64>(next - ToastMetrics::now() / 1000, 0, INT_MAX);
+    // 只有更早的截止时间才需要重新安排，避免每次添加都重启定时器
+    if (m_wheelTimer.isActive() && m_wheelTimer.remainingTime() <= delay) {
+        return;
+    }
+    m_wheelTimer.start(static_cast<int>(delay));
 }
 
-ToastConfig &ToastConfig::setCloseButtonIconSize(const QSize &size) noexcept
+void ToastManager::rescheduleWallDeadlines()
 {
-    m_closeButtonIconSize = size;
-    return *this;
+    if (m_wallDeadlines.empty()) {
+        return;
+    }
+    // 单调时钟在系统休眠期间不计时，系统时间也可能被调整，因此按系统时间重新换算全部截止时间
+    const qint64 now = ToastMetrics::now() / 1000;
+    const qint64 wallNow = QDateTime::currentMSecsSinceEpoch();
+    for (const auto &[id, deadline] : m_wallDeadlines) {
+        m_wheel.add(id, now + std::max<qint64>(0, deadline - wallNow));
+    }
+    presentScheduled();
 }
 
-ToastConfig &ToastConfig::setCloseButtonSize(const QSize &size) noexcept
+bool ToastManager::cancelScheduled(quint64 id)
 {
-    m_closeButtonSize = size;
-    return *this;
+    if (m_scheduled.erase(id) == 0) {
+        return false;
+    }
+    m_wallDeadlines.erase(id);
+    m_wheel.cancel(id);
+    ToastTracer::instance().end("scheduled", id);
+    armScheduleTimer();
+    return true;
 }
 
-ToastConfig &ToastConfig::setCloseButtonAlignment(ToastButtonAlignment alignment) noexcept
+int ToastManager::trackedCount() const noexcept
 {
-    m_closeButtonAlignment = alignment;
-    return *this;
+    return static_cast<int>(m_tracked.size());
 }
 
-ToastConfig &ToastConfig::setFadeInDuration(int duration) noexcept
+ToastHandle ToastManager::trackFuture(
+    QFuture<void> future, ToastDescriptor descriptor, ToastOutcome success, ToastOutcome failure)
 {
-    m_fadeInDuration = duration;
-    return *this;
+    // 跟踪期间由任务决定何时结束
+    descriptor.config.setDuration(0);
+    const ToastHandle handle = present(std::move(descriptor));
+    const quint64 id = handle.id();
+    auto *watcher = new QFutureWatcher<void>(qApp);
+    m_tracked.emplace(id, TrackedFuture{watcher, std::move(success), std::move(failure), false});
+    // 信号中只做标记，进度在下一帧统一读取
+    QObject::connect(
+        watcher, &QFutureWatcherBase::progressValueChanged, [this, id]() { markProgress(id); });
+    QObject::connect(
+        watcher, &QFutureWatcherBase::progressRangeChanged, [this, id]() { markProgress(id); });
+    QObject::connect(watcher, &QFutureWatcherBase::finished, [this, id]() { settleTracked(id); });
+    watcher->setFuture(future);
+    return handle;
 }
 
-ToastConfig &ToastConfig::setFadeOutDuration(int duration) noexcept
+void ToastManager::markProgress(quint64 id)
 {
-    m_fadeOutDuration = duration;
-    return *this;
+    auto it = m_tracked.find(id);
+    if (it == m_tracked.end()) {
+        return;
+    }
+    it->second.dirty = true;
+    if (m_progressTimer.isActive()) {
+        return;
+    }
+    int interval = ToastGlobalConfig::CoarseDurationBarUpdateInterval;
+    if (ToastGlobalConfig::instance().effectivePerformanceProfile()
+        != ToastPerformanceProfile::Minimal) {
+        const QScreen *screen = QGuiApplication::primaryScreen();
+        const qreal rate = screen != nullptr && screen->refreshRate() > 0 ? screen->refreshRate()
+                                                                          : 60;
+        interval = qCeil(1000 / rate);
+    }
+    m_progressTimer.start(interval);
 }
 
-ToastConfig &ToastConfig::setResetDurationOnHover(bool enabled) noexcept
+void ToastManager::flushProgress()
 {
-    m_resetDurationOnHover = enabled;
-    return *this;
+    for (auto &[id, tracked] : m_tracked) {
+        if (!tracked.dirty) {
+            continue;
+        }
+        tracked.dirty = false;
+        // 排队中的 Toast 在显示时读取最新进度
+        if (auto *toast = findShown(id)) {
+            toast->setProgress(progressOf(tracked.watcher));
+        }
+    }
 }
 
-ToastConfig &ToastConfig::setStayOnTop(bool enabled) noexcept
+void ToastManager::settleTracked(quint64 id)
 {
-    m_stayOnTop = enabled;
-    return *this;
+    auto node = m_tracked.extract(id);
+    if (node.empty()) {
+        return;
+    }
+    const TrackedFuture &tracked = node.mapped();
+    // 异常同样会使任务进入取消状态
+    const ToastOutcome &outcome = tracked.watcher->isCanceled() ? tracked.failure
+                                                                : tracked.success;
+    tracked.watcher->deleteLater();
+    ToastTracer::instance().instant("settled", id);
+    if (auto *toast = findShown(id)) {
+        const QSize previous = toast->m_notification->size();
+        toast->settle(outcome);
+        resizeShown(toast, previous);
+        return;
+    }
+    if (auto *queued = findQueued(id)) {
+        if (queued->descriptor) {
+            applyOutcome(queued->descriptor->config, outcome);
+        } else if (queued->toast) {
+            queued->toast->settle(outcome);
+        }
+    }
 }
 
-ToastConfig &ToastConfig::setBorderRadius(int borderRadius) noexcept
+void ToastManager::untrack(quint64 id)
 {
-    m_borderRadius = borderRadius;
-    return *this;
+    // Toast 在任务结束前离开管理器（关闭、取消、过期或丢弃）时停止跟踪
+    auto it = m_tracked.find(id);
+    if (it == m_tracked.end()) {
+        return;
+    }
+    it->second.watcher->deleteLater();
+    m_tracked.erase(it);
 }
 
-ToastConfig &ToastConfig::setBackgroundColor(const QColor &color) noexcept
+qreal ToastManager::progressOf(const QFutureWatcherBase *watcher) noexcept
 {
-    m_backgroundColor = color;
-    return *this;
+    const int minimum = watcher->progressMinimum();
+    const int range = watcher->progressMaximum() - minimum;
+    if (range <= 0) {
+        // 任务没有设置进度范围
+        return -1;
+    }
+    return std::clamp<qreal>(static_cast<qreal>(watcher->progressValue() - minimum) / range, 0, 1);
 }
 
-ToastConfig &ToastConfig::setTitleColor(const QColor &color) noexcept
+void ToastManager::resizeShown(Toast *toast, const QSize &previous)
 {
-    m_titleColor = color;
-    return *this;
+    const QSize size = toast->m_notification->size();
+    if (size == previous || !m_currentlyShown.contains(toast->m_id)) {
+        return;
+    }
+    m_scheduler.resize(toast->m_id, size);
+    // 底部对齐时自身的位置也随高度变化
+    toast->updatePosition();
+}
+
+void ToastManager::enqueue(quint64 id, QueuedToast &&queued)
+{
+    const ToastConfig &config = *configOf(queued);
+    const int duration = config.duration();
+    const bool buffer = m_doNotDisturb && !(m_doNotDisturbFilter && m_doNotDisturbFilter(config));
+    // 唯一标识在构造或预约时分配，重新插回队列时按这里记录的序号排序
+    const quint64 sequence = ++m_submitted;
+    queued.sequence = sequence;
+    m_queue.emplace(id, std::move(queued));
+    if (buffer) {
+        // 免打扰期间的全部开销：一次哈希插入与一次追加
+        m_buffered.push_back(id);
+        return;
+    }
+    m_scheduler.present({id, QSize(), duration, sequence});
 }
 
-ToastConfig &ToastConfig::setTextColor(const QColor &color) noexcept
+ToastManager &ToastManager::complete(Toast *toast) noexcept
 {
-    m_textColor = color;
+    if (toast == nullptr) {
+        return *this;
+    }
+    ToastTracer::instance().instant("complete", toast->m_id);
+    untrack(toast->m_id);
+    if (m_currentlyShown.remove(toast->m_id) > 0) {
+        m_metrics.recordLifetime(ToastMetrics::now() - m_shownAt.take(toast->m_id));
+        syncPolicy();
+        m_scheduler.complete(toast->m_id);
+        QTimer::singleShot(toast->config().fadeInDuration(), [this]() { presentNext(); });
+    }
+    toast->deleteLater();
     return *this;
 }
 
-ToastConfig &ToastConfig::setIconColor(const QColor &color) noexcept
+ToastManager &ToastManager::updateAllPositions() noexcept
 {
-    m_iconColor = color;
+    syncPolicy();
+    m_scheduler.relayout();
     return *this;
 }
 
-ToastConfig &ToastConfig::setIconSeparatorColor(const QColor &color) noexcept
+ToastManager &ToastManager::updateAllStyleSheets() noexcept
 {
-    m_iconSeparatorColor = color;
+    // 基础规则位于应用级样式表中，替换一次即可作用于全部 Toast
+    installToastStyleSheet();
     return *this;
 }
 
-ToastConfig &ToastConfig::setCloseButtonIconColor(const QColor &color) noexcept
+ToastManager &ToastManager::reset() noexcept
 {
-    m_closeButtonIconColor = color;
+    auto &config = ToastGlobalConfig::instance();
+    config.setMaximumOnScreen(3);
+    config.setSpacing(10);
+    config.setOffset(20, 45);
+    config.setAlwaysOnMainScreen(false);
+    config.setFixedScreen(nullptr);
+    config.setPosition(ToastPosition::BottomRight);
+    config.setStyleMode(ToastStyleMode::StyleSheet);
+    config.setHostMode(ToastHostMode::Window);
+    config.setHostWidget(nullptr);
+    config.setPerformanceProfile(ToastPerformanceProfile::Auto);
+    config.setRenderMode(ToastRenderMode::Auto);
+    config.setBackdropColor(QColor());
+
+    for (auto *toast : m_currentlyShown) {
+        toast->hide();
+        toast->deleteLater();
+    }
+    for (auto &[id, entry] : m_queue) {
+        if (entry.toast) {
+            entry.toast->deleteLater();
+        }
+    }
+    m_metrics.recordDropped(m_queue.size());
+    m_currentlyShown.clear();
+    m_shownAt.clear();
+    m_queue.clear();
+    m_deferred.clear();
+    m_buffered.clear();
+    m_replayTimer.stop();
+    m_scheduled.clear();
+    m_wallDeadlines.clear();
+    m_wheel.clear();
+    m_wheelTimer.stop();
+    for (auto &[id, tracked] : m_tracked) {
+        tracked.watcher->deleteLater();
+    }
+    m_tracked.clear();
+    m_progressTimer.stop();
+    m_scheduler.clear();
     return *this;
 }
 
-ToastConfig &ToastConfig::setDurationBarColor(const QColor &color) noexcept
+int ToastManager::count() const noexcept
 {
-    m_durationBarColor = color;
-    return *this;
+    return m_scheduler.count() + static_cast<int>(m_deferred.size() + m_buffered.size());
 }
 
-ToastConfig &ToastConfig::setTitleFont(const QFont &font) noexcept
+int ToastManager::visibleCount() const noexcept
 {
-    m_titleFont = font;
-    return *this;
+    return m_scheduler.visibleCount();
 }
 
-ToastConfig &ToastConfig::setTextFont(const QFont &font) noexcept
+int ToastManager::queuedCount() const noexcept
 {
-    m_textFont = font;
-    return *this;
+    return m_scheduler.queuedCount() + static_cast<int>(m_deferred.size() + m_buffered.size());
 }
 
-ToastConfig &ToastConfig::setMargins(const QMargins &margins) noexcept
+int ToastManager::toastOffsetY(Toast *toast) const noexcept
 {
-    m_margins = margins;
-    return *this;
+    if (toast == nullptr) {
+        return 0;
+    }
+    return m_scheduler.offsetOf(toast->m_id);
 }
 
-ToastConfig &ToastConfig::setIconMargins(const QMargins &margins) noexcept
+Toast *ToastManager::getPredecessorToast(Toast *toast) const noexcept
 {
-    m_iconMargins = margins;
-    return *this;
+    if (toast == nullptr) {
+        return nullptr;
+    }
+    return m_currentlyShown.value(m_scheduler.predecessorOf(toast->m_id));
 }
 
-ToastConfig &ToastConfig::setIconSectionMargins(const QMargins &margins) noexcept
+bool ToastManager::exists(const Toast *toast) const noexcept
 {
-    m_iconSectionMargins = margins;
-    return *this;
+    if (toast == nullptr) {
+        return false;
+    }
+    if (m_currentlyShown.value(toast->m_id) == toast) {
+        return true;
+    }
+    auto it = m_queue.find(toast->m_id);
+    return it != m_queue.end() && it->second.toast == toast;
 }
 
-ToastConfig &ToastConfig::setTextSectionMargins(const QMargins &margins) noexcept
+const ToastScheduler &ToastManager::scheduler() const noexcept
 {
-    m_textSectionMargins = margins;
-    return *this;
+    return m_scheduler;
 }
 
-ToastConfig &ToastConfig::setCloseButtonMargins(const QMargins &margins) noexcept
+ToastMetrics &ToastManager::metrics() noexcept
 {
-    m_closeButtonMargins = margins;
-    return *this;
+    return m_metrics;
 }
 
-ToastConfig &ToastConfig::setTextSectionSpacing(int spacing) noexcept
+bool ToastManager::isAdaptiveDegradationEnabled() const noexcept
 {
-    m_textSectionSpacing = spacing;
-    return *this;
+    return m_adaptiveDegradation;
 }
 
-int ToastConfig::duration() const noexcept
+ToastManager &ToastManager::setAdaptiveDegradationEnabled(bool enabled)
 {
-    return m_duration;
+    if (enabled == m_adaptiveDegradation) {
+        return *this;
+    }
+    m_adaptiveDegradation = enabled;
+    m_eventLoopLag = 0;
+    if (enabled) {
+        // 暂停期间不采样，恢复时再启动
+        if (!m_suspended) {
+            m_lagClock.start();
+            m_lagTimer.start();
+        }
+    } else {
+        m_lagTimer.stop();
+        setDegradation(ToastDegradation::None);
+    }
+    return *this;
 }
 
-bool ToastConfig::showDurationBar() const noexcept
+const std::array<int, 4> &ToastManager::lagThresholds() const noexcept
 {
-    return m_showDurationBar;
+    return m_lagThresholds;
 }
 
-const QString &ToastConfig::text() const noexcept
+ToastManager &ToastManager::setLagThresholds(const std::array<int, 4> &thresholds) noexcept
 {
-    return m_text;
+    m_lagThresholds = thresholds;
+    return *this;
 }
 
-const QString &ToastConfig::title() const noexcept
+ToastDegradation ToastManager::degradation() const noexcept
 {
-    return m_title;
+    return m_degradation;
 }
 
-const QPixmap &ToastConfig::icon() const noexcept
+int ToastManager::eventLoopLag() const noexcept
 {
-    return m_icon;
+    return qRound(m_eventLoopLag);
 }
 
-bool ToastConfig::showIcon() const noexcept
+bool ToastManager::isPauseWhenHiddenEnabled() const noexcept
 {
-    return m_showIcon;
+    return m_pauseWhenHidden;
 }
 
-const QSize &ToastConfig::iconSize() const noexcept
+ToastManager &ToastManager::setPauseWhenHiddenEnabled(bool enabled)
 {
-    return m_iconSize;
+    m_pauseWhenHidden = enabled;
+    updateSuspension();
+    return *this;
 }
 
-bool ToastConfig::showIconSeparator() const noexcept
+bool ToastManager::isSuspended() const noexcept
 {
-    return m_showIconSeparator;
+    return m_suspended;
 }
 
-int ToastConfig::iconSeparatorWidth() const noexcept
+ToastManager &ToastManager::setSuspended(bool suspended)
 {
-    return m_iconSeparatorWidth;
+    m_suspendRequested = suspended;
+    updateSuspension();
+    return *this;
 }
 
-const QPixmap &ToastConfig::closeButtonIcon() const noexcept
+ToastResumePolicy ToastManager::resumePolicy() const noexcept
 {
-    return m_closeButtonIcon;
+    return m_resumePolicy;
 }
 
-bool ToastConfig::showCloseButton() const noexcept
+ToastManager &ToastManager::setResumePolicy(ToastResumePolicy policy) noexcept
 {
-    return m_showCloseButton;
+    m_resumePolicy = policy;
+    return *this;
 }
 
-const QSize &ToastConfig::closeButtonIconSize() const noexcept
+bool ToastManager::isDoNotDisturb() const noexcept
 {
-    return m_closeButtonIconSize;
+    return m_doNotDisturb;
 }
 
-const QSize &ToastConfig::closeButtonSize() const noexcept
+ToastManager &ToastManager::setDoNotDisturb(
+    bool enabled, std::function<bool(const ToastConfig &)> filter)
 {
-    return m_closeButtonSize;
+    m_doNotDisturbFilter = std::move(filter);
+    if (enabled == m_doNotDisturb) {
+        return *this;
+    }
+    m_doNotDisturb = enabled;
+    if (enabled) {
+        // 尚未重放完的条目继续缓存，等下次关闭时一并投递
+        m_replayTimer.stop();
+    } else {
+        deliverBuffered();
+    }
+    return *this;
 }
 
-ToastButtonAlignment ToastConfig::closeButtonAlignment() const noexcept
+int ToastManager::bufferedCount() const noexcept
 {
-    return m_closeButtonAlignment;
+    return static_cast<int>(m_buffered.size());
 }
 
-int ToastConfig::fadeInDuration() const noexcept
+ToastDeliveryMode ToastManager::deliveryMode() const noexcept
 {
-    return m_fadeInDuration;
+    return m_deliveryMode;
 }
 
-int ToastConfig::fadeOutDuration() const noexcept
+ToastManager &ToastManager::setDeliveryMode(ToastDeliveryMode mode) noexcept
 {
-    return m_fadeOutDuration;
+    m_deliveryMode = mode;
+    return *this;
 }
 
-bool ToastConfig::resetDurationOnHover() const noexcept
+int ToastManager::replayInterval() const noexcept
 {
-    return m_resetDurationOnHover;
+    return m_replayTimer.interval();
 }
 
-bool ToastConfig::stayOnTop() const noexcept
+ToastManager &ToastManager::setReplayInterval(int interval)
 {
-    return m_stayOnTop;
+    m_replayTimer.setInterval(std::max(0, interval));
+    return *this;
 }
 
-int ToastConfig::borderRadius() const noexcept
+QPointer<Toast> ToastManager::success(const QString &title, const QString &text, int duration)
 {
-    return m_borderRadius;
+    return createPresetToast(ToastPreset::Success, title, text, duration);
 }
 
-const QColor &ToastConfig::backgroundColor() const noexcept
+QPointer<Toast> ToastManager::warning(const QString &title, const QString &text, int duration)
 {
-    return m_backgroundColor;
+    return createPresetToast(ToastPreset::Warning, title, text, duration);
 }
 
-const QColor &ToastConfig::titleColor() const noexcept
+QPointer<Toast> ToastManager::error(const QString &title, const QString &text, int duration)
 {
-    return m_titleColor;
+    return createPresetToast(ToastPreset::Error, title, text, duration);
 }
 
-const QColor &ToastConfig::textColor() const noexcept
+QPointer<Toast> ToastManager::information(const QString &title, const QString &text, int duration)
 {
-    return m_textColor;
+    return createPresetToast(ToastPreset::Information, title, text, duration);
 }
 
-const QColor &ToastConfig::iconColor() const noexcept
+QPointer<Toast> ToastManager::successDark(const QString &title, const QString &text, int duration)
 {
-    return m_iconColor;
+    return createPresetToast(ToastPreset::SuccessDark, title, text, duration);
 }
 
-const QColor &ToastConfig::iconSeparatorColor() const noexcept
+QPointer<Toast> ToastManager::warningDark(const QString &title, const QString &text, int duration)
 {
-    return m_iconSeparatorColor;
+    return createPresetToast(ToastPreset::WarningDark, title, text, duration);
 }
 
-const QColor &ToastConfig::closeButtonIconColor() const noexcept
+QPointer<Toast> ToastManager::errorDark(const QString &title, const QString &text, int duration)
 {
-    return m_closeButtonIconColor;
+    return createPresetToast(ToastPreset::ErrorDark, title, text, duration);
 }
 
-const QColor &ToastConfig::durationBarColor() const noexcept
+QPointer<Toast> ToastManager::informationDark(const QString &title, const QString &text, int duration)
 {
-    return m_durationBarColor;
+    return createPresetToast(ToastPreset::InformationDark, title, text, duration);
 }
 
-const QFont &ToastConfig::titleFont() const noexcept
+Toast *ToastManager::createPresetToast(
+    ToastPreset preset, const QString &title, const QString &text, int duration)
 {
-    return m_titleFont;
+    try {
+        auto toast = std::make_unique<Toast>(nullptr);
+        toast->config().setPreset(preset).setTitle(title).setText(text).setDuration(duration);
+        return toast.release();
+    } catch (const std::exception &e) {
+        qCritical() << "Failed to create preset Toast:" << e.what();
+        return nullptr;
+    } catch (...) {
+        qCritical() << "Failed to create preset Toast: Unknown exception";
+        return nullptr;
+    }
 }
 
-const QFont &ToastConfig::textFont() const noexcept
+Toast *ToastManager::materialize(quint64 id, ToastDescriptor &&descriptor)
 {
-    return m_textFont;
+    ToastTraceScope trace("construct", id);
+    auto *toast = new Toast(descriptor.parent);
+    toast->m_id = id;
+    toast->setConfig(std::move(descriptor.config));
+    toast->setData(std::move(descriptor.data));
+    toast->m_buttons = std::move(descriptor.buttons);
+    return toast;
 }
 
-const QMargins &ToastConfig::margins() const noexcept
+void ToastManager::showToast(Toast *toast)
 {
-    return m_margins;
+    ToastTraceScope trace("show", toast->m_id);
+    m_currentlyShown.insert(toast->m_id, toast);
+    const auto &globalConfig = ToastGlobalConfig::instance();
+    toast->m_hostMode = globalConfig.hostMode();
+    if (toast->m_hostMode == ToastHostMode::ScreenOverlay) {
+        if (auto *overlay = static_cast<ToastOverlay *>(overlayFor(toast->targetScreen()))) {
+            overlay->attach(toast);
+        } else {
+            toast->m_hostMode = ToastHostMode::Window;
+        }
+    } else if (toast->m_hostMode == ToastHostMode::Embedded) {
+        QWidget *host = ToastGlobalConfig::instance().hostWidget();
+        if (host == nullptr) {
+            host = toast->parentWidget();
+        }
+        if (host != nullptr) {
+            toast->setParent(host, Qt::WindowType::Widget);
+            ToastHostResizeFilter::install(host);
+        } else {
+            toast->m_hostMode = ToastHostMode::Window;
+        }
+    }
+    // 渲染方式取决于最终的承载方式，必须在回退到顶层窗口之后应用
+    toast->applyPerformanceProfile(
+        globalConfig.effectivePerformanceProfile(), globalConfig.effectiveRenderMode());
+    toast->updateWindowFlags();
+    toast->show();
+    // 控件尺寸在首次显示时确定，登记到调度器后才能计算后续 Toast 的堆叠偏移
+    m_scheduler.resize(toast->m_id, toast->m_notification->size());
+    if (toast->m_hostMode == ToastHostMode::Embedded) {
+        toast->raise();
+    }
+    toast->flyIn();
 }
 
-const QMargins &ToastConfig::iconMargins() const noexcept
+QWidget *ToastManager::overlayFor(QScreen *screen)
 {
-    return m_iconMargins;
+    if (screen == nullptr) {
+        return nullptr;
+    }
+    auto &overlay = m_overlays[screen];
+    if (overlay == nullptr) {
+        overlay = new ToastOverlay(screen);
+        QObject::connect(screen, &QObject::destroyed, overlay, [this, screen]() {
+            if (auto overlay = m_overlays.take(screen)) {
+                overlay->deleteLater();
+            }
+        });
+    }
+    return overlay;
 }
 
-const QMargins &ToastConfig::iconSectionMargins() const noexcept
+void ToastManager::sampleEventLoopLag()
 {
-    return m_iconSectionMargins;
+    // 定时器触发得比预期晚多少，就说明事件循环被占用了多久
+    const qint64 lag = std::max<qint64>(0, m_lagClock.restart() - LagSampleInterval);
+    m_metrics.recordEventLoopLag(lag * 1000);
+    m_eventLoopLag = m_eventLoopLag * (1 - LagSmoothing) + static_cast<double>(lag) * LagSmoothing;
+
+    // 每次采样最多升降一级；恢复阈值取上一级阈值的一半，避免在边界处来回切换
+    const auto level = static_cast<size_t>(m_degradation);
+    if (level < m_lagThresholds.size() && m_eventLoopLag >= m_lagThresholds[level]) {
+        setDegradation(static_cast<ToastDegradation>(level + 1));
+    } else if (level > 0 && m_eventLoopLag < m_lagThresholds[level - 1] / 2.0) {
+        setDegradation(static_cast<ToastDegradation>(level - 1));
+    }
 }
 
-const QMargins &ToastConfig::textSectionMargins() const noexcept
+void ToastManager::setDegradation(ToastDegradation degradation)
 {
-    return m_textSectionMargins;
+    if (m_degradation == degradation) {
+        return;
+    }
+    const ToastDegradation previous = m_degradation;
+    m_degradation = degradation;
+    m_metrics.recordDegradation(static_cast<int>(degradation));
+    if (degradation >= ToastDegradation::NoDurationBar) {
+        for (auto *toast : std::as_const(m_currentlyShown)) {
+            if (toast->m_durationBarTimer != nullptr) {
+                toast->m_durationBarTimer->stop();
+            }
+        }
+    } else if (previous >= ToastDegradation::NoDurationBar) {
+        for (auto *toast : std::as_const(m_currentlyShown)) {
+            if (m_suspended) {
+                // 暂停时进度条已停止，由 resume() 按记录恢复
+                toast->m_suspendedDurationBar = toast->m_suspendedRemaining >= 0
+                                                && toast->config().showDurationBar();
+            } else {
+                toast->restartDurationBar();
+            }
+        }
+    }
+    if (degradation < ToastDegradation::DeferNonErrors) {
+        releaseDeferred();
+    }
 }
 
-const QMargins &ToastConfig::closeButtonMargins() const noexcept
+bool ToastManager::shouldDefer(const QueuedToast &queued) const noexcept
 {
-    return m_closeButtonMargins;
+    if (m_suspended) {
+        return true;
+    }
+    if (m_degradation < ToastDegradation::DeferNonErrors) {
+        return false;
+    }
+    const ToastConfig *config = configOf(queued);
+    return config != nullptr && config->iconType() != ToastIcon::Error;
 }
 
-int ToastConfig::textSectionSpacing() const noexcept
+void ToastManager::releaseDeferred()
 {
-    return m_textSectionSpacing;
+    if (m_suspended) {
+        // 暂停期间 shouldDefer() 总是成立，只有 resume() 可以放行
+        return;
+    }
+    syncPolicy();
+    // 仍需暂缓的条目会在 showEntry() 中重新加入 m_deferred，先取出当前批次以免反复循环
+    std::deque<quint64> deferred;
+    deferred.swap(m_deferred);
+    for (const quint64 id : deferred) {
+        if (auto *queued = findQueued(id)) {
+            const ToastConfig *config = configOf(*queued);
+            const int duration = config != nullptr ? config->duration() : 0;
+            // 暂缓期间可能已有更晚提交的 Toast 在排队，按原有顺序插回
+            m_scheduler.presentInSequence({id, QSize(), duration, queued->sequence});
+        }
+    }
 }
 
-ToastManager &ToastManager::instance() noexcept
+bool ToastManager::cancelDeferred(quint64 id)
 {
-    static ToastManager s_instance;
-    return s_instance;
+    for (auto *pending : {&m_deferred, &m_buffered}) {
+        auto it = std::find(pending->begin(), pending->end(), id);
+        if (it != pending->end()) {
+            pending->erase(it);
+            dropEntry(id);
+            return true;
+        }
+    }
+    return false;
 }
 
-ToastManager::ToastManager()
+bool ToastManager::isExpired(const QueuedToast &queued) const
 {
-    QObject::connect(qApp, &QGuiApplication::lastWindowClosed, []() {
-        ToastManager::instance().reset();
-    });
+    const ToastConfig *config = configOf(queued);
+    return config != nullptr && config->isExpired(ToastMetrics::now() - queued.presentedAt);
 }
 
-ToastManager::~ToastManager()
+const ToastConfig *ToastManager::configOf(const QueuedToast &queued) noexcept
 {
-    reset();
+    return queued.descriptor ? &queued.descriptor->config
+           : queued.toast    ? &queued.toast->config()
+                             : nullptr;
 }
 
-ToastManager &ToastManager::present(Toast *toast) noexcept
+void ToastManager::updateSuspension()
 {
-    if (exists(toast)) {
-        return *this;
+    const bool suspended = m_suspendRequested || (m_pauseWhenHidden && isApplicationHidden());
+    if (suspended == m_suspended) {
+        return;
     }
-    auto &config = ToastGlobalConfig::instance();
-    if (m_currentlyShown.size() < static_cast<size_t>(config.maximumOnScreen())) {
-        m_currentlyShown.push_back(toast);
-        toast->show();
-        toast->flyIn();
+    m_suspended = suspended;
+    if (suspended) {
+        suspend();
     } else {
-        m_queue.push_back(toast);
+        resume();
     }
-    return *this;
 }
 
-ToastManager &ToastManager::complete(Toast *toast) noexcept
+void ToastManager::suspend()
 {
-    if (toast == nullptr) {
-        return *this;
-    }
-    auto it = std::find(m_currentlyShown.begin(), m_currentlyShown.end(), toast);
-    if (it != m_currentlyShown.end()) {
-        m_currentlyShown.erase(it);
-        updateAllPositions();
-        QTimer::singleShot(toast->config().fadeInDuration(), [this]() {
-            if (!m_queue.empty()) {
-                Toast *nextToast = m_queue.front();
-                m_queue.pop_front();
-                present(nextToast);
-            }
-        });
+    ToastTracer::instance().begin("suspended", 0);
+    m_suspendedAt = ToastMetrics::now();
+    // 隐藏的应用常被系统降低定时器精度，此时的延迟采样没有意义
+    m_lagTimer.stop();
+    for (auto *toast : std::as_const(m_currentlyShown)) {
+        toast->suspend();
     }
-    toast->deleteLater();
-    return *this;
 }
 
-ToastManager &ToastManager::updateAllPositions() noexcept
-{
-    for (auto *toast : m_currentlyShown) {
-        toast->updatePosition();
+void ToastManager::resume()
+{
+    ToastTracer::instance().end("suspended", 0);
+    const qint64 now = ToastMetrics::now();
+    const qint64 pause = (now - m_suspendedAt) / 1000;
+    const bool summarize = m_resumePolicy == ToastResumePolicy::Summarize;
+    QStringList expired;
+    if (m_resumePolicy != ToastResumePolicy::Keep) {
+        for (auto it = m_deferred.begin(); it != m_deferred.end();) {
+            const QueuedToast *queued = findQueued(*it);
+            const ToastConfig *config = queued != nullptr ? configOf(*queued) : nullptr;
+            if (config == nullptr || config->duration() == 0
+                || (now - queued->presentedAt) / 1000 < config->duration()) {
+                ++it;
+                continue;
+            }
+            if (summarize) {
+                expired.append(config->title());
+            }
+            const quint64 id = *it;
+            it = m_deferred.erase(it);
+            if (eraseQueued(id)) {
+                if (summarize) {
+                    m_metrics.recordCoalesced();
+                } else {
+                    m_metrics.recordDropped();
+                }
+            }
+        }
     }
-    return *this;
-}
-
-ToastManager &ToastManager::reset() noexcept
-{
-    auto &config = ToastGlobalConfig::instance();
-    config.setMaximumOnScreen(3);
-    config.setSpacing(10);
-    config.setOffset(20, 45);
-    config.setAlwaysOnMainScreen(false);
-    config.setFixedScreen(nullptr);
-    config.setPosition(ToastPosition::BottomRight);
-
-    for (auto *toast : m_currentlyShown) {
-        toast->hide();
-        toast->deleteLater();
+    for (auto *toast : std::as_const(m_currentlyShown)) {
+        if (m_resumePolicy != ToastResumePolicy::Keep && toast->m_suspendedRemaining >= 0
+            && toast->m_suspendedRemaining <= pause) {
+            if (summarize) {
+                expired.append(toast->config().title());
+            }
+            // 剩余时长归零，恢复后立即淡出
+            toast->m_suspendedRemaining = 0;
+        }
+        toast->resume();
     }
-    for (auto *toast : m_queue) {
-        toast->deleteLater();
+    if (m_adaptiveDegradation) {
+        m_eventLoopLag = 0;
+        m_lagClock.start();
+        m_lagTimer.start();
+    }
+    releaseDeferred();
+    if (!expired.isEmpty()) {
+        const QString title = QCoreApplication::translate(
+            "ToastManager", "%n notifications while you were away", nullptr,
+            static_cast<int>(expired.size()));
+        presentDigest(title, expired);
     }
-    m_currentlyShown.clear();
-    m_queue.clear();
-    return *this;
-}
-
-int ToastManager::count() const noexcept
-{
-    return static_cast<int>(m_currentlyShown.size() + m_queue.size());
-}
-
-int ToastManager::visibleCount() const noexcept
-{
-    return static_cast<int>(m_currentlyShown.size());
 }
 
-int ToastManager::queuedCount() const noexcept
+void ToastManager::deliverBuffered()
 {
-    return static_cast<int>(m_queue.size());
+    if (m_buffered.size() > 1 && m_deliveryMode == ToastDeliveryMode::Digest) {
+        QStringList titles;
+        for (const quint64 id : m_buffered) {
+            const QueuedToast *queued = findQueued(id);
+            const ToastConfig *config = queued != nullptr ? configOf(*queued) : nullptr;
+            if (config != nullptr) {
+                titles.append(config->title());
+            }
+            if (eraseQueued(id)) {
+                m_metrics.recordCoalesced();
+            }
+        }
+        m_buffered.clear();
+        const QString title = QCoreApplication::translate(
+            "ToastManager", "%n notifications during Do Not Disturb", nullptr,
+            static_cast<int>(titles.size()));
+        presentDigest(title, titles);
+        return;
+    }
+    if (m_buffered.size() > 1) {
+        // 第一条立即提交，其余每条都被限速器延后
+        m_metrics.recordRateLimited(m_buffered.size() - 1);
+    }
+    replayNext();
+    if (!m_buffered.empty()) {
+        m_replayTimer.start();
+    }
 }
 
-int ToastManager::toastOffsetY(Toast *toast) const noexcept
+void ToastManager::replayNext()
 {
-    if (toast == nullptr) {
-        return 0;
-    }
-    int offset = 0;
-    for (auto *t : m_currentlyShown) {
-        if (t == toast) {
+    syncPolicy();
+    while (!m_buffered.empty()) {
+        const quint64 id = m_buffered.front();
+        m_buffered.pop_front();
+        if (auto *queued = findQueued(id)) {
+            const ToastConfig *config = configOf(*queued);
+            const int duration = config != nullptr ? config->duration() : 0;
+            // 免打扰期间到达的新 Toast 可能已在排队，回放的条目仍排在它们之前
+            m_scheduler.presentInSequence({id, QSize(), duration, queued->sequence});
             break;
         }
-        offset += t->m_notification->height() + ToastGlobalConfig::instance().spacing();
     }
-    return offset;
+    if (m_buffered.empty()) {
+        m_replayTimer.stop();
+    }
 }
 
-Toast *ToastManager::getPredecessorToast(Toast *toast) const noexcept
+void ToastManager::presentDigest(const QString &title, const QStringList &titles)
 {
-    if (toast == nullptr) {
-        return nullptr;
-    }
-    Toast *prev = nullptr;
-    for (auto *t : m_currentlyShown) {
-        if (t == toast) {
-            return prev;
+    QStringList lines;
+    for (const QString &entry : titles) {
+        if (lines.size() == SummaryTitleCount) {
+            lines.append(QStringLiteral("…"));
+            break;
+        }
+        if (!entry.isEmpty()) {
+            lines.append(entry);
         }
-        prev = t;
     }
-    return prev;
+    ToastDescriptor descriptor;
+    descriptor.config.setPreset(ToastPreset::Information)
+        .setTitle(title)
+        .setText(lines.join(QLatin1Char('\n')));
+    present(std::move(descriptor));
 }
 
-bool ToastManager::exists(const Toast *toast) const noexcept
+void ToastManager::presentNext()
 {
-    if (toast == nullptr) {
-        return false;
-    }
-    return (std::find(m_currentlyShown.begin(), m_currentlyShown.end(), toast)
-            != m_currentlyShown.end())
-           || (std::find(m_queue.begin(), m_queue.end(), toast) != m_queue.end());
+    syncPolicy();
+    m_scheduler.promoteNext();
 }
 
-QPointer<Toast> ToastManager::success(const QString &title, const QString &text, int duration)
+void ToastManager::syncPolicy() noexcept
 {
-    return createPresetToast(ToastPreset::Success, title, text, duration);
+    const auto &config = ToastGlobalConfig::instance();
+    m_scheduler.setCapacity(config.maximumOnScreen()).setSpacing(config.spacing());
 }
 
-QPointer<Toast> ToastManager::warning(const QString &title, const QString &text, int duration)
+Toast *ToastManager::findShown(quint64 id) const noexcept
 {
-    return createPresetToast(ToastPreset::Warning, title, text, duration);
+    return m_currentlyShown.value(id);
 }
 
-QPointer<Toast> ToastManager::error(const QString &title, const QString &text, int duration)
+ToastManager::QueuedToast *ToastManager::findQueued(quint64 id) noexcept
 {
-    return createPresetToast(ToastPreset::Error, title, text, duration);
+    auto it = m_queue.find(id);
+    return it != m_queue.end() ? &it->second : nullptr;
 }
 
-QPointer<Toast> ToastManager::information(const QString &title, const QString &text, int duration)
+bool ToastManager::showEntry(const ToastEntry &entry)
 {
-    return createPresetToast(ToastPreset::Information, title, text, duration);
+    auto it = m_queue.find(entry.id);
+    if (it == m_queue.end()) {
+        return false;
+    }
+    if (shouldDefer(it->second)) {
+        // 条目保留在 m_queue 中，调度器跳过它并继续提升后面的错误 Toast
+        m_deferred.push_back(entry.id);
+        return false;
+    }
+    if (isExpired(it->second)) {
+        // 只在条目排到显示时检查一次，不扫描队列；调度器跳过它并提升下一条
+        eraseQueued(entry.id);
+        m_metrics.recordExpired();
+        return false;
+    }
+    const qint64 dequeuedAt = ToastMetrics::now();
+    ToastTracer::instance().end("queue", entry.id);
+    QueuedToast queued = std::move(it->second);
+    m_queue.erase(it);
+    Toast *toast = nullptr;
+    if (queued.descriptor) {
+        toast = materialize(entry.id, std::move(*queued.descriptor));
+    } else {
+        // 用户已删除该 Toast 时为空，由调度器跳过
+        toast = queued.toast;
+    }
+    if (toast == nullptr) {
+        m_metrics.recordDropped();
+        untrack(entry.id);
+        return false;
+    }
+    if (auto tracked = m_tracked.find(entry.id); tracked != m_tracked.end()) {
+        toast->setProgress(progressOf(tracked->second.watcher));
+    }
+    showToast(toast);
+    const qint64 visibleAt = ToastMetrics::now();
+    m_shownAt.insert(entry.id, visibleAt);
+    m_metrics.recordConstruction(visibleAt - dequeuedAt);
+    m_metrics.recordShown(dequeuedAt - queued.presentedAt, visibleAt - queued.presentedAt);
+    return true;
 }
 
-QPointer<Toast> ToastManager::successDark(const QString &title, const QString &text, int duration)
+void ToastManager::moveEntry(const ToastEntry &entry, int offsetY)
 {
-    return createPresetToast(ToastPreset::SuccessDark, title, text, duration);
+    Q_UNUSED(offsetY)
+    // Toast 自行计算位置，偏移经由 toastOffsetY() 从调度器读取
+    if (auto *toast = findShown(entry.id)) {
+        toast->updatePosition();
+    }
 }
 
-QPointer<Toast> ToastManager::warningDark(const QString &title, const QString &text, int duration)
+void ToastManager::dropEntry(quint64 id)
 {
-    return createPresetToast(ToastPreset::WarningDark, title, text, duration);
+    // 调度器只在 ToastHandle::close() 取消排队条目时回调，记为取消而非丢弃
+    if (eraseQueued(id)) {
+        m_metrics.recordCancelled();
+    }
 }
 
-QPointer<Toast> ToastManager::errorDark(const QString &title, const QString &text, int duration)
+bool ToastManager::eraseQueued(quint64 id)
 {
-    return createPresetToast(ToastPreset::ErrorDark, title, text, duration);
+    auto it = m_queue.find(id);
+    if (it == m_queue.end()) {
+        return false;
+    }
+    if (it->second.toast) {
+        it->second.toast->deleteLater();
+    }
+    m_queue.erase(it);
+    untrack(id);
+    ToastTracer::instance().end("queue", id);
+    return true;
 }
 
-QPointer<Toast> ToastManager::informationDark(const QString &title, const QString &text, int duration)
+Toast::Toast(QWidget *parent)
+    : QDialog(parent)
+    , m_id(nextToastId())
 {
-    return createPresetToast(ToastPreset::InformationDark, title, text, duration);
+    // Window settings
+    setAttribute(Qt::WidgetAttribute::WA_TranslucentBackground);
+    setFocusPolicy(Qt::FocusPolicy::NoFocus);
+    updateWindowFlags();
 }
 
-Toast *ToastManager::createPresetToast(
-    ToastPreset preset, const QString &title, const QString &text, int duration)
+void Toast::ensureWidgets()
 {
-    try {
-        auto toast = std::make_unique<Toast>(nullptr);
-        toast->config().setPreset(preset).setTitle(title).setText(text).setDuration(duration);
-        return toast.release();
-    } catch (const std::exception &e) {
-        qCritical() << "Failed to create preset Toast:" << e.what();
-        return nullptr;
-    } catch (...) {
-        qCritical() << "Failed to create preset Toast: Unknown exception";
-        return nullptr;
+    if (m_notification != nullptr) {
+        return;
     }
-}
-
-Toast::Toast(QWidget *parent)
-    : QDialog(parent)
-{
     // Notification widget (QLabel because QWidget has weird behaviour with stylesheets)
     m_notification = new QLabel(this);
+    m_notification->setObjectName("toast-notification");
     // Drop shadow (has to be drawn manually since only one graphics effect can be applied)
     for (size_t i = 0; i < m_dropShadowLayer.size(); i++) {
         m_dropShadowLayer[i] = new QWidget(this);
@@ -798,25 +1473,32 @@ Toast::Toast(QWidget *parent)
     connect(m_closeButton, &QPushButton::clicked, this, &Toast::hide);
     // Text and title labels
     m_titleLabel = new QLabel(m_notification);
+    m_titleLabel->setObjectName("toast-title");
     m_textLabel = new QLabel(m_notification);
+    m_textLabel->setObjectName("toast-text");
     // Icon (QPushButton instead of QLabel to get better icon quality)
     m_iconWidget = new QPushButton(m_notification);
     m_iconWidget->setObjectName("toast-icon-widget");
     // Icon separator
     m_iconSeparator = new QWidget(m_notification);
+    m_iconSeparator->setObjectName("toast-icon-separator");
     m_iconSeparator->setFixedWidth(2);
     // Duration bar container (used to make border radius possible on 4 px high widget)
     m_durationBarContainer = new QWidget(m_notification);
+    m_durationBarContainer->setObjectName("toast-duration-bar-container");
     m_durationBarContainer->setFixedHeight(4);
-    m_durationBarContainer->setStyleSheet("background: transparent;");
     // Duration bar
     m_durationBar = new QWidget(m_durationBarContainer);
+    m_durationBar->setObjectName("toast-duration-bar");
     m_durationBar->setFixedHeight(20);
     m_durationBar->move(0, -16);
     // Duration bar chunk
     m_durationBarChunk = new QWidget(m_durationBarContainer);
+    m_durationBarChunk->setObjectName("toast-duration-bar-chunk");
     m_durationBarChunk->setFixedHeight(20);
     m_durationBarChunk->move(0, -16);
+    // 进度块右端是直角，缩短时内容不变，只需重绘露出的那一条像素
+    m_durationBarChunk->setAttribute(Qt::WidgetAttribute::WA_StaticContents);
     // Timer for hiding the notification after set duration
     m_durationTimer = new QTimer(this);
     m_durationTimer->setSingleShot(true);
@@ -824,16 +1506,12 @@ Toast::Toast(QWidget *parent)
     // Timer for updating the duration bar
     m_durationBarTimer = new QTimer(this);
     connect(m_durationBarTimer, &QTimer::timeout, this, &Toast::updateDurationBar);
-    // Window settings
-    setAttribute(Qt::WidgetAttribute::WA_TranslucentBackground);
-    setFocusPolicy(Qt::FocusPolicy::NoFocus);
     setGraphicsEffect(m_opacityEffect);
-    // Set defaults
-    updateConfig();
-    // Apply stylesheet
-    QFile file(":/css/toast.css");
-    file.open(QFile::ReadOnly);
-    setStyleSheet(file.readAll());
+    // 效果只在淡入淡出期间启用：启用时任何子控件的更新都会使整个 Toast 重新渲染并合成，
+    // 禁用时倒计时每次只重绘进度条变化的像素，其余内容保留在后备存储中
+    m_opacityEffect->setEnabled(false);
+    // 基础样式规则位于应用级样式表中，只需确保已安装
+    installToastStyleSheet();
 }
 
 Toast &Toast::setConfig(const ToastConfig &config)
@@ -880,28 +1558,96 @@ const QVariant &Toast::data() const
     return m_data;
 }
 
+ToastHandle Toast::handle() const noexcept
+{
+    return ToastHandle(m_id);
+}
+
 Toast &Toast::addButton(const QString &text, std::function<void()> onClicked)
 {
     m_buttons.push_back({text, onClicked});
     return *this;
 }
 
-Toast &Toast::updateConfig()
+Toast &Toast::setProgress(qreal fraction)
 {
-    auto formatIcon = [](const QPixmap &pm, const QSize &size, const QColor &color) -> QIcon {
-        QIcon icon(pm);
-        auto iconImage = ToastConfig::recolorImage(icon.pixmap(size).toImage(), color);
-        icon = QIcon(QPixmap::fromImage(iconImage));
-        return icon;
-    };
+    const qreal progress = fraction < 0 ? -1 : std::min<qreal>(fraction, 1);
+    const bool determinateChanged = (progress < 0) != (m_progress < 0);
+    m_progress = progress;
+    if (!m_used || !m_config.showDurationBar()) {
+        // 尚未显示时在首次布局中应用
+        return *this;
+    }
+    if (determinateChanged) {
+        updateStylesheet();
+    }
+    const int fullWidth = m_durationBarContainer->width();
+    const int width = m_progress < 0 ? fullWidth
+                                     : static_cast<int>(std::floor(fullWidth * m_progress));
+    if (width != m_durationBarChunk->width()) {
+        m_durationBarChunk->setFixedWidth(width);
+    }
+    return *this;
+}
+
+Toast &Toast::appendLine(const QString &line)
+{
+    m_logLines.push_back(
+        {ToastConfig::elidedText(line, m_config.textCharacterLimit(), m_config.textLineLimit()),
+         QSize()});
+    while (static_cast<int>(m_logLines.size()) > m_config.logLineLimit()) {
+        m_logLines.pop_front();
+    }
+    if (!m_used) {
+        // 尚未显示：只更新正文，首次布局时再测量
+        flushLog();
+        return *this;
+    }
+    if (!m_logFlushPending) {
+        m_logFlushPending = true;
+        QTimer::singleShot(0, this, &Toast::flushLog);
+    }
+    return *this;
+}
+
+void Toast::flushLog()
+{
+    m_logFlushPending = false;
+    QStringList lines;
+    lines.reserve(static_cast<int>(m_logLines.size()));
+    for (const auto &logLine : m_logLines) {
+        lines.append(logLine.text);
+    }
+    m_config.setText(lines.join(QLatin1Char('\n')));
+    if (!m_used || m_fadingOut) {
+        return;
+    }
+    const QSize previous = m_notification->size();
+    m_textLabel->setText(m_config.text());
+    setupGeometry();
+    ToastManager::instance().resizeShown(this, previous);
+}
 
+qreal Toast::progress() const noexcept
+{
+    return m_progress;
+}
+
+Toast &Toast::updateConfig()
+{
+    ensureWidgets();
     updateWindowFlags();
 
+    // 已注册主题直接复用预计算结果，否则为当前外观临时计算一次
+    m_theme = m_config.theme();
+    if (m_theme.isNull()) {
+        m_theme = ToastTheme::fromConfig(m_config);
+    }
+
     // icon
     {
-        auto icon = formatIcon(m_config.icon(), m_config.iconSize(), m_config.iconColor());
         m_iconWidget->setIconSize(m_config.iconSize());
-        m_iconWidget->setIcon(icon);
+        m_iconWidget->setIcon(m_theme.icon());
         m_iconWidget->setFixedSize(m_config.iconSize());
         if (m_config.showIconSeparator()) {
             m_iconSeparator->setFixedWidth(m_config.iconSeparatorWidth());
@@ -910,24 +1656,49 @@ Toast &Toast::updateConfig()
 
     // close button
     {
-        auto icon = formatIcon(
-            m_config.closeButtonIcon(),
-            m_config.closeButtonIconSize(),
-            m_config.closeButtonIconColor());
         m_closeButton->setIconSize(m_config.closeButtonIconSize());
-        m_closeButton->setIcon(icon);
+        m_closeButton->setIcon(m_theme.closeButtonIcon());
         m_iconWidget->setFixedSize(m_config.closeButtonSize());
     }
 
     // text
     {
         m_titleLabel->setFont(m_config.titleFont());
-        m_titleLabel->setText(m_config.title());
+        if (m_textLabel->font() != m_config.textFont()) {
+            // 缓存的日志行尺寸以旧字体测量
+            for (auto &line : m_logLines) {
+                line.size = QSize();
+            }
+        }
         m_textLabel->setFont(m_config.textFont());
-        m_textLabel->setText(m_config.text());
+        // 标签只接收截断后的文本，QLabel 与 setupGeometry() 都不会处理超长的原文
+        const int characterLimit = m_config.textCharacterLimit();
+        const int lineLimit = m_config.textLineLimit();
+        bool titleElided = false;
+        bool textElided = false;
+        m_titleLabel->setText(
+            ToastConfig::elidedText(m_config.title(), characterLimit, lineLimit, &titleElided));
+        if (m_logLines.empty()) {
+            m_textLabel->setText(
+                ToastConfig::elidedText(m_config.text(), characterLimit, lineLimit, &textElided));
+        } else {
+            // 日志行在追加时已逐行截断
+            m_textLabel->setText(m_config.text());
+        }
+        m_textElided = titleElided || textElided;
+        for (QLabel *label : {m_titleLabel, m_textLabel}) {
+            if (m_textElided) {
+                label->installEventFilter(this);
+                label->setCursor(Qt::CursorShape::PointingHandCursor);
+            } else {
+                label->removeEventFilter(this);
+                label->unsetCursor();
+            }
+        }
     }
 
     updateStylesheet();
+    updateDropShadow();
 
     return *this;
 }
@@ -937,6 +1708,10 @@ Toast &Toast::updateWindowFlags()
     if (m_used || isVisible()) {
         return *this;
     }
+    if (m_hostMode != ToastHostMode::Window) {
+        // 作为覆盖窗口或宿主控件的子控件显示，不需要窗口标志
+        return *this;
+    }
     if (m_config.stayOnTop()) {
         if (parentWidget()) {
             setWindowFlags(
@@ -990,13 +1765,14 @@ void Toast::showEvent(QShowEvent *event)
     if (m_config.duration() != 0) {
         m_durationTimer->start(m_config.duration());
     }
-    if (m_config.duration() != 0 && m_config.showDurationBar()) {
-        m_durationBarTimer->start(ToastGlobalConfig::DurationBarUpdateInterval);
+    if (m_config.duration() != 0 && m_config.showDurationBar()
+        && ToastManager::instance().degradation() < ToastDegradation::NoDurationBar) {
+        m_durationBarTimer->start(durationBarInterval());
     }
 
     fadeIn();
 
-    if (parentWidget()) {
+    if (parentWidget() && m_hostMode == ToastHostMode::Window) {
         parentWidget()->activateWindow();
     }
 
@@ -1006,6 +1782,9 @@ void Toast::showEvent(QShowEvent *event)
 void Toast::enterEvent(QEvent *event)
 {
     if (m_config.duration() != 0 && m_durationTimer->isActive() && m_config.resetDurationOnHover()) {
+        // 暂停期间倒计时定时器已停止，不会进入此分支
+        ToastTracer::instance().begin("hoverPause", m_id);
+        m_hoverPaused = true;
         m_durationTimer->stop();
         if (m_config.showDurationBar()) {
             m_durationBarTimer->stop();
@@ -1018,16 +1797,52 @@ void Toast::enterEvent(QEvent *event)
 
 void Toast::leaveEvent(QEvent *event)
 {
-    if (m_config.duration() != 0 && !m_durationTimer->isActive()
-        && m_config.resetDurationOnHover()) {
-        m_durationTimer->start(m_config.duration());
-        if (m_config.showDurationBar()) {
-            m_durationBarTimer->start(ToastGlobalConfig::DurationBarUpdateInterval);
+    // 只结束由 enterEvent() 开始的悬停暂停；暂停期间停止的倒计时由 resume() 接续剩余时长
+    if (m_hoverPaused) {
+        m_hoverPaused = false;
+        ToastTracer::instance().end("hoverPause", m_id);
+        if (ToastManager::instance().isSuspended()) {
+            // 悬停后重新计时，但暂停期间不启动定时器，恢复时再从头计时
+            m_suspendedRemaining = m_config.duration();
+            m_suspendedDurationBar = m_config.showDurationBar();
+        } else {
+            m_durationTimer->start(m_config.duration());
+            if (m_config.showDurationBar()
+                && ToastManager::instance().degradation() < ToastDegradation::NoDurationBar) {
+                m_durationBarTimer->start(durationBarInterval());
+            }
         }
     }
     QDialog::leaveEvent(event);
 }
 
+bool Toast::eventFilter(QObject *watched, QEvent *event)
+{
+    if (m_textElided && event->type() == QEvent::Type::MouseButtonRelease
+        && (watched == m_titleLabel || watched == m_textLabel)) {
+        showFullText();
+        return true;
+    }
+    return QDialog::eventFilter(watched, event);
+}
+
+void Toast::showFullText()
+{
+    // 全文交给 QPlainTextEdit，它只为滚动到可见区域的段落排版；超长的行先切成有上限的段落
+    auto *viewer = new QPlainTextEdit();
+    viewer->setAttribute(Qt::WidgetAttribute::WA_DeleteOnClose);
+    viewer->setReadOnly(true);
+    viewer->setWindowTitle(ToastConfig::elidedText(m_config.title(), FullTextTitleLimit, 1));
+    if (m_config.title().isEmpty() || m_config.text().isEmpty()) {
+        viewer->setPlainText(boundedBlocks(m_config.title() + m_config.text()));
+    } else {
+        viewer->setPlainText(
+            boundedBlocks(m_config.title() + QStringLiteral("\n\n") + m_config.text()));
+    }
+    viewer->resize(FullTextViewerWidth, FullTextViewerHeight);
+    viewer->show();
+}
+
 void Toast::hideToast()
 {
     close();
@@ -1040,7 +1855,7 @@ void Toast::hideToast()
 
 void Toast::updateDurationBar()
 {
-    m_elapsedTime += ToastGlobalConfig::DurationBarUpdateInterval;
+    m_elapsedTime += m_durationBarTimer->interval();
     if (m_elapsedTime >= m_config.duration()) {
         m_durationBarTimer->stop();
         return;
@@ -1049,11 +1864,15 @@ void Toast::updateDurationBar()
         m_durationBarContainer->width()
         - (static_cast<double>(m_elapsedTime) / m_config.duration())
               * m_durationBarContainer->width());
-    m_durationBarChunk->setFixedWidth(static_cast<int>(newChunkWidth));
+    // 短间隔下相邻两次计算常落在同一像素上，此时无需任何重绘
+    if (static_cast<int>(newChunkWidth) != m_durationBarChunk->width()) {
+        m_durationBarChunk->setFixedWidth(static_cast<int>(newChunkWidth));
+    }
 }
 
 void Toast::setupUI()
 {
+    ToastTraceScope trace("setupUI", m_id);
     setupDefaultContent();
 }
 
@@ -1127,29 +1946,12 @@ void Toast::setupDefaultContent()
                 button->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Fixed);
 
                 // 设置按钮样式
-                button->setStyleSheet(QString(
-                                          "QPushButton {"
-                                          "    background-color: %1;"
-                                          "    color: %2;"
-                                          "    border: 1px solid %3;"
-                                          "    border-radius: 4px;"
-                                          "    padding: 4px 12px;"
-                                          "    font-family: %4;"
-                                          "    font-size: %5pt;"
-                                          "}"
-                                          "QPushButton:hover {"
-                                          "    background-color: %6;"
-                                          "}"
-                                          "QPushButton:pressed {"
-                                          "    background-color: %7;"
-                                          "}")
-                                          .arg(m_config.backgroundColor().darker(120).name())
-                                          .arg(m_config.textColor().name())
-                                          .arg(m_config.backgroundColor().darker(150).name())
-                                          .arg(m_config.textFont().family())
-                                          .arg(m_config.textFont().pointSize())
-                                          .arg(m_config.backgroundColor().darker(130).name())
-                                          .arg(m_config.backgroundColor().darker(160).name()));
+                button->setObjectName("toast-action-button");
+                if (ToastGlobalConfig::instance().styleMode() == ToastStyleMode::Palette) {
+                    button->setPalette(m_theme.d->buttonPalette);
+                } else {
+                    button->setStyleSheet(m_theme.d->buttonStyleSheet);
+                }
 
                 if (buttonInfo.second) {
                     QObject::connect(button, &QPushButton::clicked, buttonInfo.second);
@@ -1193,87 +1995,150 @@ void Toast::setupDefaultContent()
         }
     };
 
-    // ========================
-    // 大小处理
-    // ========================
-    auto setupGeometry = [this]() -> void {
-        // 计算文本尺寸（支持多行）
-        QFontMetrics titleFM(m_config.titleFont());
-        QFontMetrics textFM(m_config.textFont());
-
-        int titleWidth = 0, titleHeight = 0;
-        if (!m_config.title().isEmpty()) {
-            QRect rect = titleFM.boundingRect(
-                QRect(0, 0, 500, INT_MAX), Qt::TextWordWrap | Qt::AlignLeft, m_config.title());
-            titleWidth = rect.width() + 1;
-            titleHeight = rect.height();
-        }
-
-        int textWidth = 0, textHeight = 0;
-        if (!m_config.text().isEmpty()) {
-            QRect rect = textFM.boundingRect(
-                QRect(0, 0, 500, INT_MAX), Qt::TextWordWrap | Qt::AlignLeft, m_config.text());
-            textWidth = rect.width() + 1;
-            textHeight = rect.height();
-        }
+    setupLayout();             // 构建 UI 布局
+    setupGeometry();           // 计算尺寸并设置几何属性
+    move(calculatePosition()); // 定位窗口
+}
 
-        int maxWidth = std::max(titleWidth, textWidth);
-        int contentHeight = titleHeight
-                            + (!m_config.title().isEmpty() && !m_config.text().isEmpty()
-                                   ? m_config.textSectionSpacing()
-                                   : 0)
-                            + textHeight;
+void Toast::setupGeometry()
+{
+    // 计算文本尺寸（支持多行），只测量标签中截断后的文本
+    QFontMetrics titleFM(m_config.titleFont());
+    QFontMetrics textFM(m_config.textFont());
 
-        // 最小尺寸
-        int minWidth = m_config.margins().left() + (m_config.showIcon() ? 50 : 0) + maxWidth
-                       + m_config.margins().right() + (m_config.showCloseButton() ? 30 : 0);
+    int titleWidth = 0, titleHeight = 0;
+    if (!m_config.title().isEmpty()) {
+        QRect rect = titleFM.boundingRect(
+            QRect(0, 0, 500, INT_MAX), Qt::TextWordWrap | Qt::AlignLeft, m_titleLabel->text());
+        titleWidth = rect.width() + 1;
+        titleHeight = rect.height();
+    }
 
-        int minHeight = m_config.margins().top() + contentHeight + m_config.margins().bottom();
-        if (!m_buttons.empty()) {
-            minHeight += 35; // 按钮区域高度估算
-        }
-        if (m_config.showDurationBar()) {
-            minHeight += 4;
+    int textWidth = 0, textHeight = 0;
+    if (!m_logLines.empty()) {
+        // 日志行逐行测量并缓存，追加后只有新行需要测量，耗时不随历史增长
+        for (auto &line : m_logLines) {
+            if (!line.size.isValid()) {
+                QRect rect = textFM.boundingRect(
+                    QRect(0, 0, 500, INT_MAX), Qt::TextWordWrap | Qt::AlignLeft, line.text);
+                // 空行没有宽度，但在正文中仍占一行
+                line.size = line.text.isEmpty() ? QSize(0, textFM.height()) : rect.size();
+            }
+            textWidth = std::max(textWidth, line.size.width() + 1);
+            textHeight += line.size.height();
         }
+        textHeight += textFM.leading() * (static_cast<int>(m_logLines.size()) - 1);
+    } else if (!m_config.text().isEmpty()) {
+        QRect rect = textFM.boundingRect(
+            QRect(0, 0, 500, INT_MAX), Qt::TextWordWrap | Qt::AlignLeft, m_textLabel->text());
+        textWidth = rect.width() + 1;
+        textHeight = rect.height();
+    }
 
-        m_notification->setMinimumSize(minWidth, minHeight);
-        m_notification->setMaximumSize(maximumWidth(), maximumHeight());
-        m_notification->adjustSize(); // 调整到合适大小
+    int maxWidth = std::max(titleWidth, textWidth);
+    const bool hasTitleAndText = !m_config.title().isEmpty() && !m_config.text().isEmpty();
+    int contentHeight = titleHeight + (hasTitleAndText ? m_config.textSectionSpacing() : 0)
+                        + textHeight;
+    // 显示后更换正文时标题与正文之间的间距可能随之变化
+    if (auto *contentLayout = m_titleLabel->parentWidget()->layout()) {
+        contentLayout->setSpacing(hasTitleAndText ? m_config.textSectionSpacing() : 0);
+    }
 
-        // 阴影层尺寸与位置
-        int totalWidth = m_notification->width() + ToastGlobalConfig::DropShadowSize * 2;
-        int totalHeight = m_notification->height() + ToastGlobalConfig::DropShadowSize * 2;
+    // 最小尺寸
+    int minWidth = m_config.margins().left() + (m_config.showIcon() ? 50 : 0) + maxWidth
+                   + m_config.margins().right() + (m_config.showCloseButton() ? 30 : 0);
 
-        for (size_t i = 0; i < m_dropShadowLayer.size(); i++) {
-            m_dropShadowLayer.at(i)->resize(totalWidth - i * 2, totalHeight - i * 2);
-            m_dropShadowLayer.at(i)->move(i, i);
-        }
+    int minHeight = m_config.margins().top() + contentHeight + m_config.margins().bottom();
+    if (!m_buttons.empty()) {
+        minHeight += 35; // 按钮区域高度估算
+    }
+    if (m_config.showDurationBar()) {
+        minHeight += 4;
+    }
 
-        QDialog::setFixedSize(totalWidth, totalHeight);
-        m_notification->move(ToastGlobalConfig::DropShadowSize, ToastGlobalConfig::DropShadowSize);
-        m_notification->raise();
+    m_notification->setMinimumSize(minWidth, minHeight);
+    m_notification->setMaximumSize(maximumWidth(), maximumHeight());
+    m_notification->adjustSize(); // 调整到合适大小
 
-        // 持续时间条适配宽度
-        if (m_config.showDurationBar()) {
-            int notificationWidth = m_notification->width();
-            m_durationBarContainer->setFixedWidth(notificationWidth);
-            m_durationBarContainer->move(0, m_notification->height());
-            m_durationBar->setFixedWidth(notificationWidth);
-            m_durationBarChunk->setFixedWidth(notificationWidth);
-        }
-    };
+    // 阴影层尺寸与位置
+    int totalWidth = m_notification->width() + ToastGlobalConfig::DropShadowSize * 2;
+    int totalHeight = m_notification->height() + ToastGlobalConfig::DropShadowSize * 2;
 
-    setupLayout();             // 构建 UI 布局
-    setupGeometry();           // 计算尺寸并设置几何属性
-    move(calculatePosition()); // 定位窗口
+    for (size_t i = 0; i < m_dropShadowLayer.size(); i++) {
+        m_dropShadowLayer.at(i)->resize(totalWidth - i * 2, totalHeight - i * 2);
+        m_dropShadowLayer.at(i)->move(i, i);
+    }
+
+    QDialog::setFixedSize(totalWidth, totalHeight);
+    updateWindowMask();
+    m_notification->move(ToastGlobalConfig::DropShadowSize, ToastGlobalConfig::DropShadowSize);
+    m_notification->raise();
+
+    // 持续时间条适配宽度
+    if (m_config.showDurationBar()) {
+        int notificationWidth = m_notification->width();
+        m_durationBarContainer->setFixedWidth(notificationWidth);
+        m_durationBarContainer->move(0, m_notification->height());
+        m_durationBar->setFixedWidth(notificationWidth);
+        m_durationBarChunk->setFixedWidth(
+            m_progress < 0 ? notificationWidth
+                           : static_cast<int>(std::floor(notificationWidth * m_progress)));
+    }
+}
+
+void Toast::settle(const ToastOutcome &outcome)
+{
+    m_progress = -1;
+    if (!outcome.text.isEmpty()) {
+        // 结束状态的正文取代追加的日志
+        m_logLines.clear();
+    }
+    applyOutcome(m_config, outcome);
+    if (!m_used || m_fadingOut) {
+        // 尚未显示时配置在首次显示时生效；正在淡出时不再恢复
+        return;
+    }
+    // 布局已经建立，只更新样式、文本与尺寸，不重建控件
+    updateConfig();
+    setupGeometry();
+    m_elapsedTime = 0;
+    if (m_config.duration() == 0) {
+        return;
+    }
+    const bool durationBar = m_config.showDurationBar()
+                             && ToastManager::instance().degradation()
+                                    < ToastDegradation::NoDurationBar;
+    if (ToastManager::instance().isSuspended()) {
+        // 暂停期间不启动定时器，恢复时再从头计时
+        m_suspendedRemaining = m_config.duration();
+        m_suspendedDurationBar = durationBar;
+        return;
+    }
+    m_durationTimer->start(m_config.duration());
+    if (durationBar) {
+        m_durationBarTimer->start(durationBarInterval());
+    }
 }
 
 void Toast::fadeIn()
 {
+    if (!fades() || !animates(ToastDegradation::NoFades)) {
+        m_opacityEffect->setOpacity(1);
+        return;
+    }
     QPropertyAnimation *fadeInAnimation = new QPropertyAnimation(m_opacityEffect, "opacity");
     fadeInAnimation->setDuration(m_config.fadeInDuration());
     fadeInAnimation->setStartValue(0);
     fadeInAnimation->setEndValue(1);
+    connect(fadeInAnimation, &QPropertyAnimation::finished, this, [this]() {
+        if (!m_fadingOut) {
+            m_opacityEffect->setEnabled(false);
+        }
+    });
+    m_opacityEffect->setOpacity(0);
+    m_opacityEffect->setEnabled(true);
+    ToastTracer::instance().traceAnimation("fadeIn", m_id, fadeInAnimation);
+    monitorFrames(fadeInAnimation, ToastAnimationKind::Toast);
     fadeInAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
@@ -1283,19 +2148,27 @@ void Toast::fadeOut()
         return;
     }
     m_fadingOut = true;
+    if (!fades() || !animates(ToastDegradation::NoFades)) {
+        QTimer::singleShot(0, this, &Toast::hideToast);
+        return;
+    }
     QPropertyAnimation *fadeOutAnimation = new QPropertyAnimation(m_opacityEffect, "opacity");
     connect(fadeOutAnimation, &QPropertyAnimation::finished, this, &Toast::hideToast);
+    m_opacityEffect->setEnabled(true);
     fadeOutAnimation->setDuration(m_config.fadeOutDuration());
     fadeOutAnimation->setStartValue(1);
     fadeOutAnimation->setEndValue(0);
+    ToastTracer::instance().traceAnimation("fadeOut", m_id, fadeOutAnimation);
+    monitorFrames(fadeOutAnimation, ToastAnimationKind::Toast);
     fadeOutAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
 void Toast::flyIn()
 {
+    ToastTraceScope trace("flyIn", m_id);
     auto position = calculatePosition();
     // If not first toast on screen, also do a fade down / up animation
-    if (ToastManager::instance().visibleCount() > 1) {
+    if (ToastManager::instance().visibleCount() > 1 && animates(ToastDegradation::NoFlyIn)) {
         // Calculate offset if predecessor toast is still in fade down / up animation
         auto *predecessorToast = ToastManager::instance().getPredecessorToast(this);
         QPoint predecessorTarget = predecessorToast->calculatePosition();
@@ -1320,6 +2193,9 @@ void Toast::flyIn()
         QPropertyAnimation *posAnimation = new QPropertyAnimation(this, "pos");
         posAnimation->setEndValue(QPoint(position.x(), position.y()));
         posAnimation->setDuration(m_config.fadeInDuration());
+        reserveHostArea(pos(), position, posAnimation);
+        ToastTracer::instance().traceAnimation("flyIn.animation", m_id, posAnimation);
+        monitorFrames(posAnimation, ToastAnimationKind::Toast);
         posAnimation->start(QAbstractAnimation::DeleteWhenStopped);
     } else {
         move(position);
@@ -1329,73 +2205,187 @@ void Toast::flyIn()
 void Toast::updatePosition()
 {
     QPoint position = calculatePosition();
+    if (!animates(ToastDegradation::NoFlyIn)) {
+        move(position);
+        return;
+    }
     QPropertyAnimation *posAnimation = new QPropertyAnimation(this, "pos");
     posAnimation->setEndValue(position);
     posAnimation->setDuration(ToastGlobalConfig::UpdatePositionDuration);
+    reserveHostArea(pos(), position, posAnimation);
+    ToastTracer::instance().traceAnimation("reflow", m_id, posAnimation);
+    monitorFrames(posAnimation, ToastAnimationKind::Reflow);
     posAnimation->start(QAbstractAnimation::DeleteWhenStopped);
 }
 
-void Toast::updateStylesheet()
+void Toast::reserveHostArea(const QPoint &from, const QPoint &to, QAbstractAnimation *animation)
 {
-    m_notification->setStyleSheet(QString(
-                                      "background: %1;"
-                                      "border-radius: %2px; ")
-                                      .arg(m_config.backgroundColor().name())
-                                      .arg(m_config.borderRadius()));
+    if (m_hostMode != ToastHostMode::ScreenOverlay || parentWidget() == nullptr) {
+        return;
+    }
+    auto *overlay = static_cast<ToastOverlay *>(parentWidget());
+    overlay->reserve(QRect(from, size()).united(QRect(to, size())));
+    connect(animation, &QAbstractAnimation::finished, overlay, [overlay]() {
+        overlay->scheduleRefresh();
+    });
+}
 
-    m_durationBar->setStyleSheet(QString(
-                                     "background: rgba(%1, %2, %3, 100);"
-                                     "border-radius: %4px;")
-                                     .arg(m_config.durationBarColor().red())
-                                     .arg(m_config.durationBarColor().green())
-                                     .arg(m_config.durationBarColor().blue())
-                                     .arg(m_config.borderRadius()));
+void Toast::applyPerformanceProfile(ToastPerformanceProfile profile, ToastRenderMode renderMode)
+{
+    m_profile = profile;
+    // 覆盖窗口与嵌入模式下 Toast 是子控件，由 Qt 在后备存储中合成，不依赖窗口合成器
+    m_opaque = renderMode == ToastRenderMode::Opaque && m_hostMode == ToastHostMode::Window;
+    if (m_hostMode == ToastHostMode::Window) {
+        setAttribute(Qt::WidgetAttribute::WA_TranslucentBackground, !m_opaque);
+    }
+}
 
-    m_durationBarChunk->setStyleSheet(
-        QString(
-            "background: rgba(%1, %2, %3, 255);"
-            "border-bottom-left-radius: %4px; border-bottom-right-radius: %5px;")
-            .arg(m_config.durationBarColor().red())
-            .arg(m_config.durationBarColor().green())
-            .arg(m_config.durationBarColor().blue())
-            .arg(m_config.borderRadius())
-            .arg(m_config.duration() == 0 ? m_config.borderRadius() : 0));
+bool Toast::fades() const noexcept
+{
+    // 不透明窗口的不透明度效果只会让内容向背景色渐变，而不是真正的透明
+    return !m_opaque && m_profile != ToastPerformanceProfile::Minimal;
+}
 
-    m_iconSeparator->setStyleSheet(
-        QString("background: %1;").arg(m_config.iconSeparatorColor().name()));
+bool Toast::animates(ToastDegradation level) const noexcept
+{
+    return m_profile != ToastPerformanceProfile::Minimal
+           && ToastManager::instance().degradation() < level;
+}
 
-    m_titleLabel->setStyleSheet(QString("color: %1;").arg(m_config.titleColor().name()));
-    m_textLabel->setStyleSheet(QString("color: %1;").arg(m_config.textColor().name()));
+int Toast::durationBarInterval() const noexcept
+{
+    return m_profile == ToastPerformanceProfile::Minimal
+               ? ToastGlobalConfig::CoarseDurationBarUpdateInterval
+               : ToastGlobalConfig::DurationBarUpdateInterval;
 }
 
-QPoint Toast::calculatePosition()
+void Toast::updateDropShadow()
 {
-    int offsetY = ToastManager::instance().toastOffsetY(this);
+    if (!m_opaque) {
+        return;
+    }
+    const QColor &backdrop = ToastGlobalConfig::instance().backdropColor();
+    QColor color = backdrop.isValid() ? backdrop : palette().color(QPalette::ColorRole::Window);
+    // 圆角边缘的抗锯齿像素与窗口背景混合，背景色与预合成的起点一致时边缘才不会出现色差
+    QPalette windowPalette = palette();
+    windowPalette.setColor(QPalette::ColorRole::Window, color);
+    setPalette(windowPalette);
+    // 阴影层由外向内叠加，每一层都是在前一层结果上再叠一层半透明黑色
+    for (size_t i = 0; i < m_dropShadowLayer.size(); i++) {
+        const qreal keep = 1.0 - DropShadowLayerAlphas.at(i) / 255.0;
+        color = QColor::fromRgbF(color.redF() * keep, color.greenF() * keep, color.blueF() * keep);
+        m_dropShadowLayer.at(i)->setStyleSheet(
+            QStringLiteral("background: %1; border-radius: %2px;")
+                .arg(color.name())
+                .arg(DropShadowLayerRadius));
+    }
+}
 
-    // Get screen
-    QScreen *primaryScreen = QGuiApplication::primaryScreen();
-    QScreen *currentScreen = nullptr;
+void Toast::updateWindowMask()
+{
+    if (!m_opaque) {
+        return;
+    }
+    // 不透明窗口没有 alpha 通道，圆角之外的区域由遮罩裁掉，露出下方的桌面
+    QPainterPath path;
+    path.addRoundedRect(QRectF(rect()), DropShadowLayerRadius, DropShadowLayerRadius);
+    setMask(QRegion(path.toFillPolygon().toPolygon()));
+}
 
-    if (ToastGlobalConfig::instance().fixedScreen()) {
-        currentScreen = ToastGlobalConfig::instance().fixedScreen();
-    } else if (ToastGlobalConfig::instance().alwaysOnMainScreen() || !parentWidget()) {
-        currentScreen = primaryScreen;
-    } else {
-        QList<QScreen *> screens = QGuiApplication::screens();
+void Toast::suspend()
+{
+    m_suspendedRemaining = -1;
+    m_suspendedDurationBar = false;
+    if (m_durationTimer == nullptr) {
+        return;
+    }
+    if (m_durationTimer->isActive()) {
+        m_suspendedRemaining = m_durationTimer->remainingTime();
+        m_durationTimer->stop();
+    }
+    if (m_durationBarTimer->isActive()) {
+        m_suspendedDurationBar = true;
+        m_durationBarTimer->stop();
+    }
+}
 
-        for (auto *&screen : screens) {
-            if (parentWidget()->geometry().intersects(screen->geometry())) {
-                if (!currentScreen) {
-                    currentScreen = screen;
-                } else {
-                    currentScreen = primaryScreen;
-                    break;
-                }
-            }
+void Toast::resume()
+{
+    if (m_durationTimer == nullptr) {
+        return;
+    }
+    if (m_suspendedRemaining >= 0) {
+        m_durationTimer->start(m_suspendedRemaining);
+    }
+    if (m_suspendedDurationBar
+        && ToastManager::instance().degradation() < ToastDegradation::NoDurationBar) {
+        m_durationBarTimer->start(durationBarInterval());
+    }
+    m_suspendedRemaining = -1;
+    m_suspendedDurationBar = false;
+}
+
+void Toast::restartDurationBar()
+{
+    // 悬停暂停或正在淡出时倒计时不在进行，进度条保持原样
+    if (m_durationBarTimer == nullptr || m_fadingOut || m_config.duration() == 0
+        || !m_config.showDurationBar() || !m_durationTimer->isActive()) {
+        return;
+    }
+    // 进度条停止期间倒计时仍在进行，按剩余时长重新同步已用时间
+    m_elapsedTime = m_config.duration() - m_durationTimer->remainingTime();
+    m_durationBarTimer->start(durationBarInterval());
+}
+
+void Toast::monitorFrames(QVariantAnimation *animation, ToastAnimationKind kind)
+{
+    auto &metrics = ToastManager::instance().metrics();
+    if (!metrics.isFrameMonitorEnabled()) {
+        return;
+    }
+    const QScreen *screen = targetScreen();
+    metrics.monitorAnimation(animation, kind, screen != nullptr ? screen->refreshRate() : 0);
+}
+
+void Toast::updateStylesheet()
+{
+    const auto &theme = *m_theme.d;
+    if (ToastGlobalConfig::instance().styleMode() == ToastStyleMode::Palette) {
+        const QVariant radius = qBound(0, m_config.borderRadius(), PaletteModeMaxBorderRadius);
+        m_notification->setPalette(theme.notificationPalette);
+        m_notification->setProperty("toastRadius", radius);
+        m_durationBar->setPalette(theme.durationBarPalette);
+        m_durationBar->setProperty("toastRadius", radius);
+        m_durationBarChunk->setPalette(theme.durationBarChunkPalette);
+        m_durationBarChunk->setProperty("toastRadius", radius);
+        const QVariant infinite = m_config.duration() == 0 && m_progress < 0;
+        if (m_durationBarChunk->property("toastInfinite") != infinite) {
+            // 动态属性改变后需要重新应用样式，进度 Toast 结束时会在显示期间切换
+            m_durationBarChunk->setProperty("toastInfinite", infinite);
+            m_durationBarChunk->style()->unpolish(m_durationBarChunk);
+            m_durationBarChunk->style()->polish(m_durationBarChunk);
         }
+        m_iconSeparator->setPalette(theme.iconSeparatorPalette);
+        m_titleLabel->setPalette(theme.titlePalette);
+        m_textLabel->setPalette(theme.textPalette);
+        return;
     }
+    m_notification->setStyleSheet(theme.notificationStyleSheet);
+    m_durationBar->setStyleSheet(theme.durationBarStyleSheet);
+    m_durationBarChunk->setStyleSheet(
+        m_config.duration() == 0 && m_progress < 0 ? theme.durationBarChunkStyleSheetInfinite
+                                                   : theme.durationBarChunkStyleSheet);
+    m_iconSeparator->setStyleSheet(theme.iconSeparatorStyleSheet);
+    m_titleLabel->setStyleSheet(theme.titleStyleSheet);
+    m_textLabel->setStyleSheet(theme.textStyleSheet);
+}
 
-    if (currentScreen == nullptr) {
+QPoint Toast::calculatePosition()
+{
+    int offsetY = ToastManager::instance().toastOffsetY(this);
+
+    const QRect area = hostArea();
+    if (area.isNull()) {
         return QPoint();
     }
 
@@ -1406,39 +2396,27 @@ QPoint Toast::calculatePosition()
     auto gOffsetX = ToastGlobalConfig::instance().offsetX();
     auto gOffsetY = ToastGlobalConfig::instance().offsetY();
     if (gPosition == ToastPosition::BottomRight) {
-        x = currentScreen->geometry().width() - m_notification->width() - gOffsetX
-            + currentScreen->geometry().x();
-        y = currentScreen->geometry().height() - m_notification->height() - gOffsetY
-            + currentScreen->geometry().y() - offsetY;
+        x = area.width() - m_notification->width() - gOffsetX + area.x();
+        y = area.height() - m_notification->height() - gOffsetY + area.y() - offsetY;
     } else if (gPosition == ToastPosition::BottomLeft) {
-        x = currentScreen->geometry().x() + gOffsetX;
-        y = currentScreen->geometry().height() - m_notification->height() - gOffsetY
-            + currentScreen->geometry().y() - offsetY;
+        x = area.x() + gOffsetX;
+        y = area.height() - m_notification->height() - gOffsetY + area.y() - offsetY;
     } else if (gPosition == ToastPosition::BottomMiddle) {
-        x = static_cast<int>(
-            currentScreen->geometry().x() + currentScreen->geometry().width() / 2
-            - m_notification->width() / 2);
-        y = currentScreen->geometry().height() - m_notification->height() - gOffsetY
-            + currentScreen->geometry().y() - offsetY;
+        x = static_cast<int>(area.x() + area.width() / 2 - m_notification->width() / 2);
+        y = area.height() - m_notification->height() - gOffsetY + area.y() - offsetY;
     } else if (gPosition == ToastPosition::TopRight) {
-        x = currentScreen->geometry().width() - m_notification->width() - gOffsetX
-            + currentScreen->geometry().x();
-        y = currentScreen->geometry().y() + gOffsetY + offsetY;
+        x = area.width() - m_notification->width() - gOffsetX + area.x();
+        y = area.y() + gOffsetY + offsetY;
     } else if (gPosition == ToastPosition::TopLeft) {
-        x = currentScreen->geometry().x() + gOffsetX;
-        y = currentScreen->geometry().y() + gOffsetY + offsetY;
+        x = area.x() + gOffsetX;
+        y = area.y() + gOffsetY + offsetY;
     } else if (gPosition == ToastPosition::TopMiddle) {
-        x = static_cast<int>(
-            currentScreen->geometry().x() + currentScreen->geometry().width() / 2
-            - m_notification->width() / 2);
-        y = currentScreen->geometry().y() + gOffsetY + offsetY;
+        x = static_cast<int>(area.x() + area.width() / 2 - m_notification->width() / 2);
+        y = area.y() + gOffsetY + offsetY;
     } else if (gPosition == ToastPosition::Center) {
-        x = static_cast<int>(
-            currentScreen->geometry().x() + currentScreen->geometry().width() / 2
-            - m_notification->width() / 2);
+        x = static_cast<int>(area.x() + area.width() / 2 - m_notification->width() / 2);
         y = static_cast<int>(
-            currentScreen->geometry().y() + currentScreen->geometry().height() / 2
-            - m_notification->height() / 2 + offsetY);
+            area.y() + area.height() / 2 - m_notification->height() / 2 + offsetY);
     }
 
     x -= ToastGlobalConfig::DropShadowSize;
@@ -1446,3 +2424,38 @@ QPoint Toast::calculatePosition()
 
     return QPoint(x, y);
 }
+
+QScreen *Toast::targetScreen() const
+{
+    QScreen *primaryScreen = QGuiApplication::primaryScreen();
+    QScreen *currentScreen = nullptr;
+
+    if (ToastGlobalConfig::instance().fixedScreen()) {
+        currentScreen = ToastGlobalConfig::instance().fixedScreen();
+    } else if (ToastGlobalConfig::instance().alwaysOnMainScreen() || !parentWidget()) {
+        currentScreen = primaryScreen;
+    } else {
+        QList<QScreen *> screens = QGuiApplication::screens();
+
+        for (auto *&screen : screens) {
+            if (parentWidget()->geometry().intersects(screen->geometry())) {
+                if (!currentScreen) {
+                    currentScreen = screen;
+                } else {
+                    currentScreen = primaryScreen;
+                    break;
+                }
+            }
+        }
+    }
+    return currentScreen;
+}
+
+QRect Toast::hostArea() const
+{
+    if (m_hostMode != ToastHostMode::Window && parentWidget()) {
+        return parentWidget()->rect();
+    }
+    QScreen *screen = targetScreen();
+    return screen ? screen->geometry() : QRect();
+}
@@ -1,616 +1,403 @@
 #pragma once
 
+#include "ToastConfig.h"
+#include "ToastMetrics.h"
+#include "ToastScheduler.h"
+#include "ToastTimerWheel.h"
+#include <array>
+#include <chrono>
 #include <deque>
 #include <functional>
+#include <optional>
+#include <unordered_map>
 #include <QDialog>
+#include <QElapsedTimer>
+#include <QFuture>
 #include <QGraphicsOpacityEffect>
 #include <QLabel>
-#include <QPointer>
 #include <QPushButton>
 #include <QScreen>
 #include <QTimer>
 #include <QVariant>
 #include <QWidget>
 
+class QAbstractAnimation;
+class QDateTime;
+class QFutureWatcherBase;
+class QVariantAnimation;
 class Toast;
 
-enum class ToastPreset {
-    Success,
-    Warning,
-    Error,
-    Information,
-    SuccessDark,
-    WarningDark,
-    ErrorDark,
-    InformationDark
-};
-
-enum class ToastIcon { Success, Warning, Error, Information, Close };
+/**
+ * @brief 自定义按钮：按钮文本与点击回调。
+ */
+using ToastButton = std::pair<QString, std::function<void()>>;
 
-enum class ToastPosition {
-    BottomLeft,
-    BottomMiddle,
-    BottomRight,
-    TopLeft,
-    TopMiddle,
-    TopRight,
-    Center
+/**
+ * @brief 轻量级 Toast 描述符，仅包含创建 Toast 所需的数据，不持有任何控件。
+ *
+ * 通过 ToastManager::present(ToastDescriptor) 提交后，若屏幕已满则以描述符形式排队，
+ * 直到有空位时才真正创建 Toast 控件。
+ */
+struct ToastDescriptor
+{
+    ToastConfig config;               ///< Toast 配置
+    std::vector<ToastButton> buttons; ///< 自定义按钮
+    QVariant data;                    ///< 用户数据
+    QPointer<QWidget> parent;         ///< 父级控件，可为空
 };
 
-enum class ToastButtonAlignment { Top, Middle, Bottom };
+/**
+ * @brief 进度 Toast 在任务结束时原地切换到的状态。
+ */
+struct ToastOutcome
+{
+    ToastPreset preset{ToastPreset::Success}; ///< 切换到的预设
+    QString text;                             ///< 替换的正文，为空时保留原正文
+    int duration{5000};                       ///< 切换后的显示时长（毫秒）
+};
 
 /**
- * @brief 全局单例类，用于管理 Toast 组件的所有全局配置。
+ * @brief Toast 句柄，无论 Toast 仍在队列中（尚未创建控件）还是已经显示，都可以通过它访问和控制。
  *
  */
-class ToastGlobalConfig final
+class QTTOAST_WIDGETS_EXPORT ToastHandle final
 {
 public:
-    static ToastGlobalConfig &instance() noexcept;
-
-    Q_DISABLE_COPY_MOVE(ToastGlobalConfig)
-
-    // 全局常量 (Colors & Sizes)
-    static const int UpdatePositionDuration;    ///< 位置更新动画时长 (毫秒)
-    static const int DurationBarUpdateInterval; ///< 进度条更新间隔 (毫秒)
-    static const int DropShadowSize;            ///< 阴影大小 (像素)
-    static const QColor SuccessAccentColor;
-    static const QColor WarningAccentColor;
-    static const QColor ErrorAccentColor;
-    static const QColor InformationAccentColor;
-    static const QColor DefaultAccentColor;
-    static const QColor DefaultBackgroundColor;
-    static const QColor DefaultTitleColor;
-    static const QColor DefaultTextColor;
-    static const QColor DefaultIconSeparatorColor;
-    static const QColor DefaultCloseButtonIconColor;
-    static const QColor DefaultBackgroundColorDark;
-    static const QColor DefaultTitleColorDark;
-    static const QColor DefaultTextColorDark;
-    static const QColor DefaultIconSeparatorColorDark;
-    static const QColor DefaultCloseButtonIconColorDark;
-
-    /**
-     * @brief 获取当前允许同时在屏幕上显示的最大 Toast 数量。
-     * @return 最大显示数量。
-     */
-    [[nodiscard]] int maximumOnScreen() const noexcept;
-
-    /**
-     * @brief 设置允许同时在屏幕上显示的最大 Toast 数量。
-     * @param maximum 指定的最大数量。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastGlobalConfig &setMaximumOnScreen(int maximum) noexcept;
+    ToastHandle() = default;
+    explicit ToastHandle(quint64 id) noexcept;
 
     /**
-     * @brief 获取相邻 Toast 之间的垂直间距（像素）。
-     * @return 间距值。
+     * @brief 获取句柄对应的唯一标识。
+     * @return 标识值，0 表示空句柄。
      */
-    [[nodiscard]] int spacing() const noexcept;
+    [[nodiscard]] quint64 id() const noexcept;
 
     /**
-     * @brief 设置相邻 Toast 之间的垂直间距（像素）。
-     * @param spacing 指定的间距值。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastGlobalConfig &setSpacing(int spacing) noexcept;
-
-    /**
-     * @brief 获取 Toast 相对于其锚定边缘的水平偏移量（像素）。
-     * @return 水平偏移量。
-     */
-    [[nodiscard]] int offsetX() const noexcept;
-
-    /**
-     * @brief 获取 Toast 相对于其锚定边缘的垂直偏移量（像素）。
-     * @return 垂直偏移量。
-     */
-    [[nodiscard]] int offsetY() const noexcept;
-
-    /**
-     * @brief 同时设置 Toast 相对于其锚定边缘的水平和垂直偏移量（像素）。
-     * @param x 水平偏移量。
-     * @param y 垂直偏移量。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastGlobalConfig &setOffset(int x, int y) noexcept;
-
-    /**
-     * @brief 设置 Toast 相对于其锚定边缘的水平偏移量（像素）。
-     * @param offsetX 指定的水平偏移量。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastGlobalConfig &setOffsetX(int offsetX) noexcept;
-
-    /**
-     * @brief 设置 Toast 相对于其锚定边缘的垂直偏移量（像素）。
-     * @param offsetY 指定的垂直偏移量。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 查询句柄对应的 Toast 是否仍由管理器管理（正在显示或在队列中）。
+     * @return 如果仍然存在则返回 true。
      */
-    ToastGlobalConfig &setOffsetY(int offsetY) noexcept;
+    [[nodiscard]] bool isValid() const noexcept;
 
     /**
-     * @brief 查询是否强制将所有 Toast 显示在主屏幕上。
-     * @return true 表示强制在主屏幕显示。
+     * @brief 查询句柄对应的 Toast 是否仍在等待队列中。
+     * @return 如果在队列中则返回 true。
      */
-    [[nodiscard]] bool alwaysOnMainScreen() const noexcept;
+    [[nodiscard]] bool isQueued() const noexcept;
 
     /**
-     * @brief 设置是否强制将所有 Toast 显示在主屏幕上。
-     * @param enabled true 表示启用此功能。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 查询句柄对应的 Toast 是否仍在等待定时提交。
+     * @return 如果尚未到提交时间则返回 true。
      */
-    ToastGlobalConfig &setAlwaysOnMainScreen(bool enabled) noexcept;
+    [[nodiscard]] bool isScheduled() const noexcept;
 
     /**
-     * @brief 获取当前被固定作为 Toast 显示目标的特定屏幕。
-     * @return 固定的 QScreen 指针，如果未设置则返回 nullptr。
+     * @brief 获取句柄对应的 Toast 控件。
+     * @return Toast 指针；如果仍以描述符形式排队或已结束则返回 nullptr。
      */
-    [[nodiscard]] QScreen *fixedScreen() const noexcept;
+    [[nodiscard]] Toast *toast() const noexcept;
 
     /**
-     * @brief 设置一个固定的屏幕，所有 Toast 将显示在此屏幕上。
-     * @param screen 指向目标 QScreen 的指针。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取句柄对应 Toast 的配置，排队中的描述符同样可以修改。
+     * @return 配置指针，如果句柄已失效则返回 nullptr。请勿长期持有该指针。
      */
-    ToastGlobalConfig &setFixedScreen(QScreen *screen) noexcept;
+    [[nodiscard]] ToastConfig *config() const noexcept;
 
     /**
-     * @brief 获取 Toast 在屏幕上的默认显示位置。
-     * @return ToastPosition 枚举值。
+     * @brief 关闭句柄对应的 Toast：排队中的直接移出队列，显示中的执行淡出。
      */
-    [[nodiscard]] ToastPosition position() const noexcept;
+    void close() const noexcept;
 
-    /**
-     * @brief 设置 Toast 在屏幕上的默认显示位置。
-     * @param position ToastPosition 枚举值。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastGlobalConfig &setPosition(ToastPosition position) noexcept;
+    [[nodiscard]] bool operator==(const ToastHandle &other) const noexcept;
+    [[nodiscard]] bool operator!=(const ToastHandle &other) const noexcept;
 
 private:
-    explicit ToastGlobalConfig() = default;
-    int m_maximumOnScreen{3};
-    int m_spacing{10};
-    int m_offsetX{20};
-    int m_offsetY{45};
-    bool m_alwaysOnMainScreen{false};
-    QScreen *m_fixedScreen{nullptr};
-    ToastPosition m_position{ToastPosition::BottomRight};
+    quint64 m_id{0};
 };
 
 /**
- * @brief 配置类，用于定义单个 Toast 实例的外观和行为。
+ * @brief 管理类，负责管理所有 Toast 实例的生命周期、队列和屏幕布局。
  *
  */
-class ToastConfig final
+class QTTOAST_WIDGETS_EXPORT ToastManager final : private ToastRenderer
 {
 public:
-    ToastConfig() = default;
-
-    /**
-     * @brief 根据枚举值获取对应的图标 QPixmap。
-     * @param enumIcon ToastIcon 枚举值。
-     * @return 对应图标的 QPixmap。
-     */
-    static QPixmap getIconFromEnum(ToastIcon enumIcon) noexcept;
-
-    /**
-     * @brief 将给定的 QImage 的颜色重新着色为指定的颜色，同时保留原始透明度。
-     * @param image 需要重新着色的 QImage。
-     * @param color 新的颜色。
-     * @return 重新着色后的 QImage。
-     */
-    static QImage recolorImage(QImage image, const QColor &color) noexcept;
-
-    /**
-     * @brief 应用预设样式到此配置。
-     * @param preset 要应用的预设（例如，Success, Warning）。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastConfig &setPreset(ToastPreset preset) noexcept;
-
-    /**
-     * @brief 设置 Toast 的显示持续时间。
-     * @param duration 持续时间，单位为毫秒；0 表示无限持续时间。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastConfig &setDuration(int duration) noexcept;
+    static ToastManager &instance() noexcept;
 
-    /**
-     * @brief 启用或禁用持续时间进度条的显示。
-     * @param enabled true 表示显示进度条。
-     * @return 当前对象的引用，支持链式调用。
-     */
-    ToastConfig &setShowDurationBar(bool enabled) noexcept;
+    Q_DISABLE_COPY_MOVE(ToastManager)
+    ~ToastManager();
 
     /**
-     * @brief 设置标题文本。
-     * @param title 标题字符串。
+     * @brief 请求立即显示一个 Toast。如果达到最大显示数量，则将其加入队列。
+     * @param toast 指向待显示 Toast 的指针。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setTitle(const QString &title) noexcept;
+    ToastManager &present(Toast *toast) noexcept;
 
     /**
-     * @brief 设置主要内容文本。
-     * @param text 要显示的文本。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 以描述符形式请求显示一个 Toast。如果达到最大显示数量，则仅将描述符加入队列，
+     *        直到有空位时才创建控件。
+     * @param descriptor Toast 描述符。
+     * @return 对应的 Toast 句柄。
      */
-    ToastConfig &setText(const QString &text) noexcept;
+    ToastHandle present(ToastDescriptor descriptor) noexcept;
 
     /**
-     * @brief 设置自定义图标 pixmap。
-     * @param icon 用作图标的 pixmap。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 在指定延迟后提交一个 Toast。等待期间只保存描述符，不创建控件；
+     *        所有定时提交由一个分层时间轮和一个定时器驱动，精度为 100 毫秒。
+     * @param descriptor Toast 描述符。
+     * @param delay 延迟。
+     * @return 对应的 Toast 句柄，提交前可以通过 close() 取消，或通过 config() 修改配置。
      */
-    ToastConfig &setIcon(const QPixmap &icon) noexcept;
+    ToastHandle schedule(ToastDescriptor descriptor, std::chrono::milliseconds delay);
 
     /**
-     * @brief 使用内置枚举设置图标。
-     * @param icon 图标类型（Success, Warning 等）。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 在指定时刻提交一个 Toast。时间轮到期时以及应用重新变为活动状态（如休眠唤醒）时
+     *        都会按当前系统时间重新核对，系统时间调整或休眠后仍在该时刻附近提交。
+     * @param descriptor Toast 描述符。
+     * @param deadline 提交时刻，早于当前时间时尽快提交。
+     * @return 对应的 Toast 句柄。
      */
-    ToastConfig &setIcon(ToastIcon icon) noexcept;
+    ToastHandle schedule(ToastDescriptor descriptor, const QDateTime &deadline);
 
     /**
-     * @brief 显示或隐藏图标区域。
-     * @param enabled true 表示显示图标。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取等待定时提交的 Toast 数量。
+     * @return 数量。
      */
-    ToastConfig &setShowIcon(bool enabled) noexcept;
+    [[nodiscard]] int scheduledCount() const noexcept;
 
     /**
-     * @brief 设置图标的尺寸。
-     * @param size 期望的尺寸。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 以进度 Toast 跟踪一个异步任务（QtConcurrent 或 QPromise 的 QFuture）。任务设置了进度范围时
+     *        显示确定进度，否则显示不确定进度；进度更新只记录数值，按屏幕刷新率合并后才更新进度条，
+     *        频繁的 progressValueChanged 不会逐次重绘。任务结束后同一个 Toast 原地切换到成功或失败状态，
+     *        无需再创建第二个 Toast。
+     * @param future 任务的 QFuture，必须在 GUI 线程中调用。
+     * @param descriptor Toast 描述符，跟踪期间持续时间固定为 0。
+     * @param success 任务完成时切换到的状态。
+     * @param failure 任务被取消或抛出异常时切换到的状态。
+     * @return 对应的 Toast 句柄。
      */
-    ToastConfig &setIconSize(const QSize &size) noexcept;
+    template<typename T>
+    ToastHandle track(
+        const QFuture<T> &future,
+        ToastDescriptor descriptor,
+        ToastOutcome success = {ToastPreset::Success},
+        ToastOutcome failure = {ToastPreset::Error})
+    {
+        return trackFuture(
+            QFuture<void>(future), std::move(descriptor), std::move(success), std::move(failure));
+    }
 
     /**
-     * @brief 显示或隐藏图标与文本之间的垂直分隔线。
-     * @param enabled true 表示显示分隔线。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取正在跟踪任务的进度 Toast 数量。
+     * @return 数量。
      */
-    ToastConfig &setShowIconSeparator(bool enabled) noexcept;
+    [[nodiscard]] int trackedCount() const noexcept;
 
     /**
-     * @brief 设置图标分隔线的宽度。
-     * @param width 宽度，单位为像素。
+     * @brief 通知管理器某个 Toast 已完成（通常是因为用户关闭或超时），需要从显示列表中移除并处理队列中的下一个。
+     * @param toast 指向已完成 Toast 的指针。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setIconSeparatorWidth(int width) noexcept;
+    ToastManager &complete(Toast *toast) noexcept;
 
     /**
-     * @brief 设置自定义关闭按钮图标。
-     * @param icon 关闭按钮的 pixmap。
+     * @brief 重新计算并更新所有正在显示的 Toast 的位置，以反映任何可能的变化（如新 Toast 出现或旧 Toast 消失）。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setCloseButtonIcon(const QPixmap &icon) noexcept;
+    ToastManager &updateAllPositions() noexcept;
 
     /**
-     * @brief 使用内置枚举设置关闭按钮图标。
-     * @param icon 应为 Close 图标。
+     * @brief 将当前的基础样式表一次性重新应用到所有已创建控件的 Toast（显示中及队列中的）。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setCloseButtonIcon(ToastIcon icon) noexcept;
+    ToastManager &updateAllStyleSheets() noexcept;
 
     /**
-     * @brief 显示或隐藏关闭按钮。
-     * @param enabled true 表示显示按钮。
+     * @brief 重置管理器状态：清除所有配置、清空显示和等待队列，并删除所有现存的 Toast。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setShowCloseButton(bool enabled) noexcept;
+    ToastManager &reset() noexcept;
 
     /**
-     * @brief 设置关闭按钮图标的尺寸。
-     * @param size 图标尺寸。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取当前总共存在的 Toast 数量（包括正在显示的和在队列中的）。
+     * @return 总数量。
      */
-    ToastConfig &setCloseButtonIconSize(const QSize &size) noexcept;
+    [[nodiscard]] int count() const noexcept;
 
     /**
-     * @brief 设置关闭按钮区域的总尺寸。
-     * @param size 区域尺寸。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取当前正在屏幕上显示的 Toast 数量。
+     * @return 可见数量。
      */
-    ToastConfig &setCloseButtonSize(const QSize &size) noexcept;
+    [[nodiscard]] int visibleCount() const noexcept;
 
     /**
-     * @brief 设置关闭按钮在其区域内对齐方式。
-     * @param alignment Top, Middle 或 Bottom。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取当前在等待队列中的 Toast 数量。
+     * @return 队列数量。
      */
-    ToastConfig &setCloseButtonAlignment(ToastButtonAlignment alignment) noexcept;
+    [[nodiscard]] int queuedCount() const noexcept;
 
     /**
-     * @brief 设置淡入动画的持续时间。
-     * @param duration 持续时间，单位为毫秒。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 计算指定 Toast 相对于其位置锚点的垂直偏移量，该偏移量由其前面的 Toast 决定。
+     * @param toast 指向目标 Toast 的指针。
+     * @return 垂直偏移量（像素）。
      */
-    ToastConfig &setFadeInDuration(int duration) noexcept;
+    [[nodiscard]] int toastOffsetY(Toast *toast) const noexcept;
 
     /**
-     * @brief 设置淡出动画的持续时间。
-     * @param duration 持续时间，单位为毫秒。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取在屏幕上位于指定 Toast 之前的那个 Toast。
+     * @param toast 指向目标 Toast 的指针。
+     * @return 指向前驱 Toast 的指针，如果没有前驱则返回 nullptr。
      */
-    ToastConfig &setFadeOutDuration(int duration) noexcept;
+    [[nodiscard]] Toast *getPredecessorToast(Toast *toast) const noexcept;
 
     /**
-     * @brief 当鼠标悬停在 Toast 上时重置其持续时间计时器。
-     * @param enabled true 表示启用悬停时重置功能。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 检查指定的 Toast 是否存在于管理器的显示列表或等待队列中。
+     * @param toast 指向待检查 Toast 的指针。
+     * @return 如果存在则返回 true。
      */
-    ToastConfig &setResetDurationOnHover(bool enabled) noexcept;
+    [[nodiscard]] bool exists(const Toast *toast) const noexcept;
 
     /**
-     * @brief 使 Toast 保持在其他窗口之上。
-     * @param enabled true 表示启用置顶行为。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取决定队列、最大显示数量与堆叠偏移的调度核心。
+     * @return 调度器的常量引用。
      */
-    ToastConfig &setStayOnTop(bool enabled) noexcept;
+    [[nodiscard]] const ToastScheduler &scheduler() const noexcept;
 
     /**
-     * @brief 设置圆角矩形的圆角半径。
-     * @param borderRadius 半径，单位为像素。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取运行指标：提交、显示、丢弃等计数器，以及排队等待、显示延迟、
+     *        显示时长与构建耗时的直方图。可直接读取快照，或设置上报间隔后连接 reported 信号。
+     * @return 指标记录器的引用。
      */
-    ToastConfig &setBorderRadius(int borderRadius) noexcept;
+    [[nodiscard]] ToastMetrics &metrics() noexcept;
 
     /**
-     * @brief 设置 Toast 的背景颜色。
-     * @param color 背景颜色。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 查询是否根据事件循环延迟自适应降级。
+     * @return 开启时返回 true。
      */
-    ToastConfig &setBackgroundColor(const QColor &color) noexcept;
+    [[nodiscard]] bool isAdaptiveDegradationEnabled() const noexcept;
 
     /**
-     * @brief 设置标题文本的颜色。
-     * @param color 标题文本颜色。
+     * @brief 开启或关闭自适应降级。开启后持续采样事件循环延迟，超过阈值时逐级降级，
+     *        延迟降到上一级阈值的一半以下时逐级恢复。关闭时立即恢复为 ToastDegradation::None。
+     * @param enabled 是否开启。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setTitleColor(const QColor &color) noexcept;
+    ToastManager &setAdaptiveDegradationEnabled(bool enabled);
 
     /**
-     * @brief 设置正文文本的颜色。
-     * @param color 正文文本颜色。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取进入各降级级别的延迟阈值。
+     * @return 依次对应 NoDurationBar、NoFlyIn、NoFades、DeferNonErrors 的阈值（毫秒）。
      */
-    ToastConfig &setTextColor(const QColor &color) noexcept;
+    [[nodiscard]] const std::array<int, 4> &lagThresholds() const noexcept;
 
     /**
-     * @brief 设置应用于图标的色调颜色。
-     * @param color 图标色调颜色。
+     * @brief 设置进入各降级级别的延迟阈值。
+     * @param thresholds 依次对应 NoDurationBar、NoFlyIn、NoFades、DeferNonErrors 的阈值（毫秒），
+     *                   默认为 50、100、200、400。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setIconColor(const QColor &color) noexcept;
+    ToastManager &setLagThresholds(const std::array<int, 4> &thresholds) noexcept;
 
     /**
-     * @brief 设置图标分隔线的颜色。
-     * @param color 分隔线颜色。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取当前的降级级别。
+     * @return 降级级别。
      */
-    ToastConfig &setIconSeparatorColor(const QColor &color) noexcept;
+    [[nodiscard]] ToastDegradation degradation() const noexcept;
 
     /**
-     * @brief 设置关闭按钮图标的颜色。
-     * @param color 关闭图标颜色。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取平滑后的事件循环延迟。
+     * @return 延迟（毫秒），未开启自适应降级时为 0。
      */
-    ToastConfig &setCloseButtonIconColor(const QColor &color) noexcept;
+    [[nodiscard]] int eventLoopLag() const noexcept;
 
     /**
-     * @brief 设置持续时间进度条的颜色。
-     * @param color 进度条颜色。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 查询应用隐藏时是否自动暂停。
+     * @return 开启时返回 true。
      */
-    ToastConfig &setDurationBarColor(const QColor &color) noexcept;
+    [[nodiscard]] bool isPauseWhenHiddenEnabled() const noexcept;
 
     /**
-     * @brief 设置标题的字体。
-     * @param font 标题字体。
+     * @brief 开启或关闭隐藏时自动暂停（默认开启）。应用被挂起、隐藏，或所有窗口都已最小化、
+     *        不在当前虚拟桌面、被锁屏遮挡时，暂停所有倒计时与进度条，并停止从队列中取出新的 Toast；
+     *        恢复可见后从暂停处继续。
+     * @param enabled 是否开启。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setTitleFont(const QFont &font) noexcept;
+    ToastManager &setPauseWhenHiddenEnabled(bool enabled);
 
     /**
-     * @brief 设置正文文本的字体。
-     * @param font 正文文本字体。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 查询当前是否处于暂停状态。
+     * @return 暂停时返回 true。
      */
-    ToastConfig &setTextFont(const QFont &font) noexcept;
+    [[nodiscard]] bool isSuspended() const noexcept;
 
     /**
-     * @brief 设置围绕整个 Toast 的外边距。
-     * @param margins 边距（左、上、右、下）。
+     * @brief 手动暂停或恢复，例如应用通过平台接口收到锁屏通知时。手动暂停与自动检测取并集。
+     * @param suspended 是否暂停。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setMargins(const QMargins &margins) noexcept;
+    ToastManager &setSuspended(bool suspended);
 
     /**
-     * @brief 设置围绕图标的边距。
-     * @param margins 图标专用边距。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取恢复时对过期 Toast 的处理方式。
+     * @return ToastResumePolicy 枚举值。
      */
-    ToastConfig &setIconMargins(const QMargins &margins) noexcept;
+    [[nodiscard]] ToastResumePolicy resumePolicy() const noexcept;
 
     /**
-     * @brief 设置围绕图标区域（容器）的边距。
-     * @param margins 容器边距。
+     * @brief 设置恢复时对过期 Toast 的处理方式。
+     * @param policy ToastResumePolicy 枚举值。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setIconSectionMargins(const QMargins &margins) noexcept;
+    ToastManager &setResumePolicy(ToastResumePolicy policy) noexcept;
 
     /**
-     * @brief 设置围绕文本区域（容器）的边距。
-     * @param margins 容器边距。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 查询是否处于免打扰模式。
+     * @return 开启时返回 true。
      */
-    ToastConfig &setTextSectionMargins(const QMargins &margins) noexcept;
+    [[nodiscard]] bool isDoNotDisturb() const noexcept;
 
     /**
-     * @brief 设置围绕关闭按钮的边距。
-     * @param margins 按钮边距。
+     * @brief 开启或关闭免打扰模式。开启期间，未被过滤器放行的 Toast 只以队列条目的形式记录下来，
+     *        不进入调度器，也不创建控件；关闭时按投递方式一次性汇总或限速重放。
+     * @param enabled 是否开启。
+     * @param filter 放行过滤器，返回 true 的 Toast 照常显示；为空时全部缓存。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastConfig &setCloseButtonMargins(const QMargins &margins) noexcept;
+    ToastManager &setDoNotDisturb(
+        bool enabled, std::function<bool(const ToastConfig &)> filter = nullptr);
 
     /**
-     * @brief 设置图标区域和文本区域之间的间距。
-     * @param spacing 间距，单位为像素。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取免打扰期间缓存的 Toast 数量。
+     * @return 缓存数量。
      */
-    ToastConfig &setTextSectionSpacing(int spacing) noexcept;
-
-    [[nodiscard]] int duration() const noexcept;
-    [[nodiscard]] bool showDurationBar() const noexcept;
-    [[nodiscard]] const QString &text() const noexcept;
-    [[nodiscard]] const QString &title() const noexcept;
-    [[nodiscard]] const QPixmap &icon() const noexcept;
-    [[nodiscard]] bool showIcon() const noexcept;
-    [[nodiscard]] const QSize &iconSize() const noexcept;
-    [[nodiscard]] bool showIconSeparator() const noexcept;
-    [[nodiscard]] int iconSeparatorWidth() const noexcept;
-    [[nodiscard]] const QPixmap &closeButtonIcon() const noexcept;
-    [[nodiscard]] bool showCloseButton() const noexcept;
-    [[nodiscard]] const QSize &closeButtonIconSize() const noexcept;
-    [[nodiscard]] const QSize &closeButtonSize() const noexcept;
-    [[nodiscard]] ToastButtonAlignment closeButtonAlignment() const noexcept;
-    [[nodiscard]] int fadeInDuration() const noexcept;
-    [[nodiscard]] int fadeOutDuration() const noexcept;
-    [[nodiscard]] bool resetDurationOnHover() const noexcept;
-    [[nodiscard]] bool stayOnTop() const noexcept;
-    [[nodiscard]] int borderRadius() const noexcept;
-    [[nodiscard]] const QColor &backgroundColor() const noexcept;
-    [[nodiscard]] const QColor &titleColor() const noexcept;
-    [[nodiscard]] const QColor &textColor() const noexcept;
-    [[nodiscard]] const QColor &iconColor() const noexcept;
-    [[nodiscard]] const QColor &iconSeparatorColor() const noexcept;
-    [[nodiscard]] const QColor &closeButtonIconColor() const noexcept;
-    [[nodiscard]] const QColor &durationBarColor() const noexcept;
-    [[nodiscard]] const QFont &titleFont() const noexcept;
-    [[nodiscard]] const QFont &textFont() const noexcept;
-    [[nodiscard]] const QMargins &margins() const noexcept;
-    [[nodiscard]] const QMargins &iconMargins() const noexcept;
-    [[nodiscard]] const QMargins &iconSectionMargins() const noexcept;
-    [[nodiscard]] const QMargins &textSectionMargins() const noexcept;
-    [[nodiscard]] const QMargins &closeButtonMargins() const noexcept;
-    [[nodiscard]] int textSectionSpacing() const noexcept;
-
-private:
-    int m_duration{5000};
-    bool m_showDurationBar{true};
-    QString m_title;
-    QString m_text;
-    QPixmap m_icon{getIconFromEnum(ToastIcon::Information)};
-    bool m_showIcon{false};
-    QSize m_iconSize{18, 18};
-    bool m_showIconSeparator{true};
-    int m_iconSeparatorWidth{2};
-    QPixmap m_closeButtonIcon{getIconFromEnum(ToastIcon::Close)};
-    bool m_showCloseButton{true};
-    QSize m_closeButtonIconSize{10, 10};
-    QSize m_closeButtonSize{24, 24};
-    ToastButtonAlignment m_closeButtonAlignment{ToastButtonAlignment::Middle};
-    int m_fadeInDuration = 250;
-    int m_fadeOutDuration = 250;
-    bool m_resetDurationOnHover{true};
-    bool m_stayOnTop{true};
-    int m_borderRadius{4};
-    QColor m_backgroundColor{ToastGlobalConfig::DefaultBackgroundColor};
-    QColor m_titleColor{ToastGlobalConfig::DefaultTitleColor};
-    QColor m_textColor{ToastGlobalConfig::DefaultTextColor};
-    QColor m_iconColor{ToastGlobalConfig::DefaultAccentColor};
-    QColor m_iconSeparatorColor{ToastGlobalConfig::DefaultIconSeparatorColor};
-    QColor m_closeButtonIconColor{ToastGlobalConfig::DefaultCloseButtonIconColor};
-    QColor m_durationBarColor{ToastGlobalConfig::DefaultAccentColor};
-    QFont m_titleFont{"Arial", 10, QFont::Bold};
-    QFont m_textFont{"Arial", 9};
-    QMargins m_margins{20, 18, 10, 18};
-    QMargins m_iconMargins{0, 0, 15, 0};
-    QMargins m_iconSectionMargins{0, 0, 15, 0};
-    QMargins m_textSectionMargins{0, 0, 15, 0};
-    QMargins m_closeButtonMargins{0, -8, 0, -8};
-    int m_textSectionSpacing = 8;
-};
-
-/**
- * @brief 管理类，负责管理所有 Toast 实例的生命周期、队列和屏幕布局。
- *
- */
-class ToastManager final
-{
-public:
-    static ToastManager &instance() noexcept;
-
-    Q_DISABLE_COPY_MOVE(ToastManager)
-    ~ToastManager();
+    [[nodiscard]] int bufferedCount() const noexcept;
 
     /**
-     * @brief 请求立即显示一个 Toast。如果达到最大显示数量，则将其加入队列。
-     * @param toast 指向待显示 Toast 的指针。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取关闭免打扰模式时缓存 Toast 的投递方式。
+     * @return ToastDeliveryMode 枚举值。
      */
-    ToastManager &present(Toast *toast) noexcept;
+    [[nodiscard]] ToastDeliveryMode deliveryMode() const noexcept;
 
     /**
-     * @brief 通知管理器某个 Toast 已完成（通常是因为用户关闭或超时），需要从显示列表中移除并处理队列中的下一个。
-     * @param toast 指向已完成 Toast 的指针。
+     * @brief 设置关闭免打扰模式时缓存 Toast 的投递方式。
+     * @param mode ToastDeliveryMode 枚举值。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastManager &complete(Toast *toast) noexcept;
+    ToastManager &setDeliveryMode(ToastDeliveryMode mode) noexcept;
 
     /**
-     * @brief 重新计算并更新所有正在显示的 Toast 的位置，以反映任何可能的变化（如新 Toast 出现或旧 Toast 消失）。
-     * @return 当前对象的引用，支持链式调用。
+     * @brief 获取 Replay 投递方式下相邻两条 Toast 的提交间隔。
+     * @return 间隔（毫秒）。
      */
-    ToastManager &updateAllPositions() noexcept;
+    [[nodiscard]] int replayInterval() const noexcept;
 
     /**
-     * @brief 重置管理器状态：清除所有配置、清空显示和等待队列，并删除所有现存的 Toast。
+     * @brief 设置 Replay 投递方式下相邻两条 Toast 的提交间隔。
+     * @param interval 间隔（毫秒），默认 2000。
      * @return 当前对象的引用，支持链式调用。
      */
-    ToastManager &reset() noexcept;
-
-    /**
-     * @brief 获取当前总共存在的 Toast 数量（包括正在显示的和在队列中的）。
-     * @return 总数量。
-     */
-    [[nodiscard]] int count() const noexcept;
-
-    /**
-     * @brief 获取当前正在屏幕上显示的 Toast 数量。
-     * @return 可见数量。
-     */
-    [[nodiscard]] int visibleCount() const noexcept;
-
-    /**
-     * @brief 获取当前在等待队列中的 Toast 数量。
-     * @return 队列数量。
-     */
-    [[nodiscard]] int queuedCount() const noexcept;
-
-    /**
-     * @brief 计算指定 Toast 相对于其位置锚点的垂直偏移量，该偏移量由其前面的 Toast 决定。
-     * @param toast 指向目标 Toast 的指针。
-     * @return 垂直偏移量（像素）。
-     */
-    [[nodiscard]] int toastOffsetY(Toast *toast) const noexcept;
-
-    /**
-     * @brief 获取在屏幕上位于指定 Toast 之前的那个 Toast。
-     * @param toast 指向目标 Toast 的指针。
-     * @return 指向前驱 Toast 的指针，如果没有前驱则返回 nullptr。
-     */
-    [[nodiscard]] Toast *getPredecessorToast(Toast *toast) const noexcept;
-
-    /**
-     * @brief 检查指定的 Toast 是否存在于管理器的显示列表或等待队列中。
-     * @param toast 指向待检查 Toast 的指针。
-     * @return 如果存在则返回 true。
-     */
-    [[nodiscard]] bool exists(const Toast *toast) const noexcept;
+    ToastManager &setReplayInterval(int interval);
 
     /**
      * @brief 快速显示一个成功样式的 Toast。
@@ -693,18 +480,115 @@ public:
         const QString &title, const QString &text, int duration = 5000);
 
 private:
+    friend class ToastHandle;
+    friend class Toast;
+
+    /**
+     * @brief 队列条目：用户已创建的 Toast，或尚未实例化的描述符。
+     */
+    struct QueuedToast
+    {
+        QPointer<Toast> toast;                     ///< 用户已创建的 Toast
+        std::optional<ToastDescriptor> descriptor; ///< 延迟创建的 Toast 描述符
+        qint64 presentedAt{0};                     ///< 提交时间（ToastMetrics::now()）
+        quint64 sequence{0};                       ///< 进入队列的序号，唯一标识不反映提交顺序
+    };
+
+    /**
+     * @brief 正在跟踪的异步任务。
+     */
+    struct TrackedFuture
+    {
+        QFutureWatcherBase *watcher{nullptr}; ///< 任务监视器，任务结束后删除
+        ToastOutcome success;                 ///< 完成时切换到的状态
+        ToastOutcome failure;                 ///< 取消或异常时切换到的状态
+        bool dirty{false};                    ///< 上次刷新后进度是否变化
+    };
+
     explicit ToastManager();
     [[nodiscard]] static Toast *createPresetToast(
         ToastPreset preset, const QString &title, const QString &text, int duration);
-    std::deque<Toast *> m_currentlyShown; ///< 当前正在屏幕上的 Toast 列表
-    std::deque<Toast *> m_queue;          ///< 等待显示的 Toast 队列
+    [[nodiscard]] static Toast *materialize(quint64 id, ToastDescriptor &&descriptor);
+    void showToast(Toast *toast);
+    void presentNext();
+    void syncPolicy() noexcept;
+    void sampleEventLoopLag();
+    void setDegradation(ToastDegradation degradation);
+    [[nodiscard]] bool shouldDefer(const QueuedToast &queued) const noexcept;
+    void releaseDeferred();
+    bool cancelDeferred(quint64 id);
+    void updateSuspension();
+    void suspend();
+    void resume();
+    void presentDigest(const QString &title, const QStringList &titles);
+    void enqueue(quint64 id, QueuedToast &&queued);
+    void presentScheduled();
+    void armScheduleTimer();
+    void rescheduleWallDeadlines();
+    bool cancelScheduled(quint64 id);
+    void deliverBuffered();
+    void replayNext();
+    bool eraseQueued(quint64 id);
+    ToastHandle trackFuture(
+        QFuture<void> future,
+        ToastDescriptor descriptor,
+        ToastOutcome success,
+        ToastOutcome failure);
+    void markProgress(quint64 id);
+    void flushProgress();
+    void settleTracked(quint64 id);
+    void untrack(quint64 id);
+    [[nodiscard]] static qreal progressOf(const QFutureWatcherBase *watcher) noexcept;
+    void resizeShown(Toast *toast, const QSize &previous);
+    [[nodiscard]] static const ToastConfig *configOf(const QueuedToast &queued) noexcept;
+    [[nodiscard]] bool isExpired(const QueuedToast &queued) const;
+    [[nodiscard]] Toast *findShown(quint64 id) const noexcept;
+    [[nodiscard]] QueuedToast *findQueued(quint64 id) noexcept;
+    [[nodiscard]] QWidget *overlayFor(QScreen *screen);
+
+    // ToastRenderer
+    bool showEntry(const ToastEntry &entry) override;
+    void moveEntry(const ToastEntry &entry, int offsetY) override;
+    void dropEntry(quint64 id) override;
+
+    ToastScheduler m_scheduler;                       ///< 队列与堆叠顺序
+    QHash<quint64, Toast *> m_currentlyShown;         ///< 当前正在屏幕上的 Toast
+    QHash<quint64, qint64> m_shownAt;                 ///< 显示中 Toast 的显示时间
+    std::unordered_map<quint64, QueuedToast> m_queue; ///< 等待显示的 Toast，顺序由调度器维护
+    QHash<QScreen *, QPointer<QWidget>> m_overlays;   ///< 每个屏幕的覆盖窗口
+    ToastMetrics m_metrics;                           ///< 运行指标
+    QTimer m_lagTimer;                                ///< 事件循环延迟采样定时器
+    QElapsedTimer m_lagClock;                         ///< 上次采样以来的实际时间
+    double m_eventLoopLag{0};                         ///< 平滑后的事件循环延迟（毫秒）
+    std::array<int, 4> m_lagThresholds{50, 100, 200, 400}; ///< 各降级级别的阈值（毫秒）
+    ToastDegradation m_degradation{ToastDegradation::None}; ///< 当前降级级别
+    quint64 m_submitted{0};                           ///< 已进入队列的 Toast 数量，用作提交序号
+    std::deque<quint64> m_deferred; ///< 降级或暂停期间暂缓显示的 Toast，条目仍保留在 m_queue 中
+    bool m_adaptiveDegradation{false};                ///< 是否开启自适应降级
+    QTimer m_visibilityTimer;                         ///< 应用非活动期间轮询窗口可见性
+    bool m_pauseWhenHidden{true};                     ///< 隐藏时是否自动暂停
+    bool m_suspendRequested{false};                   ///< 是否手动暂停
+    bool m_suspended{false};                          ///< 当前是否暂停
+    qint64 m_suspendedAt{0};                          ///< 暂停开始时间（ToastMetrics::now()）
+    ToastResumePolicy m_resumePolicy{ToastResumePolicy::Keep}; ///< 恢复时对过期 Toast 的处理
+    bool m_doNotDisturb{false};                                 ///< 是否处于免打扰模式
+    std::function<bool(const ToastConfig &)> m_doNotDisturbFilter; ///< 免打扰期间的放行过滤器
+    std::deque<quint64> m_buffered; ///< 免打扰期间缓存的 Toast，条目仍保留在 m_queue 中
+    ToastDeliveryMode m_deliveryMode{ToastDeliveryMode::Digest}; ///< 缓存 Toast 的投递方式
+    QTimer m_replayTimer;                                         ///< 限速重放定时器
+    ToastTimerWheel m_wheel;                                      ///< 定时提交的截止时间
+    std::unordered_map<quint64, ToastDescriptor> m_scheduled;     ///< 等待定时提交的描述符
+    std::unordered_map<quint64, qint64> m_wallDeadlines; ///< 按系统时间定时的截止时刻（UTC 毫秒）
+    QTimer m_wheelTimer;                                          ///< 驱动时间轮的唯一定时器
+    std::unordered_map<quint64, TrackedFuture> m_tracked;         ///< 正在跟踪任务的进度 Toast
+    QTimer m_progressTimer; ///< 按屏幕刷新率合并进度更新的单次定时器
 };
 
 /**
  * @brief Toast 组件的核心实现类，代表一个独立的通知消息框。
  *
  */
-class Toast final : public QDialog
+class QTTOAST_WIDGETS_EXPORT Toast final : public QDialog
 {
     Q_OBJECT
 public:
@@ -766,6 +650,12 @@ public:
      */
     const QVariant &data() const;
 
+    /**
+     * @brief 获取此 Toast 的句柄。
+     * @return Toast 句柄。
+     */
+    [[nodiscard]] ToastHandle handle() const noexcept;
+
     /**
      * @brief 为 Toast 添加一个自定义按钮。
      * @param text 按钮上显示的文本。
@@ -774,6 +664,27 @@ public:
      */
     Toast &addButton(const QString &text, std::function<void()> onClicked);
 
+    /**
+     * @brief 设置进度条显示的进度，用于持续时间为 0 的 Toast。宽度落在同一像素上时不重绘。
+     * @param fraction 进度，范围 [0, 1]；小于 0 表示不确定进度，进度条显示为满格。
+     * @return 对自身的引用，用于链式调用。
+     */
+    Toast &setProgress(qreal fraction);
+
+    /**
+     * @brief 追加一行日志，适合跟随构建或部署步骤的输出。只保留最近 logLineLimit() 行作为正文，
+     *        每行的尺寸测量一次后缓存，追加时只测量新行；显示期间同一轮事件循环中的多次追加合并为一次更新。
+     * @param line 日志行。
+     * @return 对自身的引用，用于链式调用。
+     */
+    Toast &appendLine(const QString &line);
+
+    /**
+     * @brief 获取进度条显示的进度。
+     * @return 进度，小于 0 表示不确定进度。
+     */
+    [[nodiscard]] qreal progress() const noexcept;
+
     /**
      * @brief 根据当前配置更新 Toast 的 UI 样式。
      * @return 对自身的引用，用于链式调用。
@@ -823,6 +734,14 @@ protected:
      */
     void leaveEvent(QEvent *event) override;
 
+    /**
+     * @brief 重写 eventFilter，文本被截断时点击标题或正文打开全文窗口。
+     * @param watched 被监视的对象。
+     * @param event 事件。
+     * @return 事件已处理时返回 true。
+     */
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
     /**
      * @brief 开始执行淡出动画，并在动画结束后彻底隐藏和清理 Toast。
@@ -835,6 +754,11 @@ private slots:
     void updateDurationBar();
 
 private:
+    /**
+     * @brief 按需创建子控件、定时器和透明度效果。构造时不创建，排队中的 Toast 因此只占用极少资源。
+     */
+    void ensureWidgets();
+
     /**
      * @brief 初始化所有 UI 组件，如标签、按钮等。
      */
@@ -845,6 +769,28 @@ private:
      */
     void setupDefaultContent();
 
+    /**
+     * @brief 按当前文本计算尺寸并设置几何属性。显示后内容变化时可以再次调用，布局不会重建。
+     */
+    void setupGeometry();
+
+    /**
+     * @brief 在单独的窗口中显示未截断的标题与正文，窗口只在点击时创建。
+     */
+    void showFullText();
+
+    /**
+     * @brief 将追加的日志行应用到正文并重新计算尺寸，由 appendLine() 合并调度。
+     */
+    void flushLog();
+
+    /**
+     * @brief 进度 Toast 的任务结束后原地切换到指定状态：更换预设与正文，重新计算尺寸，
+     *        并从头开始倒计时。尚未显示时只修改配置。
+     * @param outcome 切换到的状态。
+     */
+    void settle(const ToastOutcome &outcome);
+
     /**
      * @brief 执行淡入动画效果。
      */
@@ -866,22 +812,125 @@ private:
     void updatePosition();
 
     /**
-     * @brief 根据当前配置更新控件的内联样式表，以改变其外观。
+     * @brief 应用显示时生效的性能配置与渲染方式。必须在确定承载方式之后调用，
+     *        只有顶层窗口模式会使用不透明渲染。
+     * @param profile Full 或 Minimal。
+     * @param renderMode Translucent 或 Opaque。
+     */
+    void applyPerformanceProfile(ToastPerformanceProfile profile, ToastRenderMode renderMode);
+
+    /**
+     * @brief 查询是否使用淡入淡出：不透明窗口与 Minimal 性能配置下不使用不透明度效果。
+     * @return 使用时返回 true。
+     */
+    [[nodiscard]] bool fades() const noexcept;
+
+    /**
+     * @brief 查询在当前性能配置与降级级别下是否执行某类动画。
+     * @param level 关闭该类动画的降级级别。
+     * @return 需要执行动画时返回 true。
+     */
+    [[nodiscard]] bool animates(ToastDegradation level) const noexcept;
+
+    /**
+     * @brief 获取持续时间进度条的更新间隔，Minimal 性能配置下使用粗粒度间隔。
+     * @return 间隔（毫秒）。
+     */
+    [[nodiscard]] int durationBarInterval() const noexcept;
+
+    /**
+     * @brief 不透明渲染时将各阴影层预先合成到背景色上，使阴影无需 alpha 混合。
+     */
+    void updateDropShadow();
+
+    /**
+     * @brief 暂停倒计时与进度条，记录剩余时长。
+     */
+    void suspend();
+
+    /**
+     * @brief 从 suspend() 记录的剩余时长继续倒计时与进度条。
+     */
+    void resume();
+
+    /**
+     * @brief 降级级别回落后重新启动停止的进度条，并按剩余时长同步已用时间。
+     *        悬停暂停或淡出中的 Toast 不受影响。
+     */
+    void restartDurationBar();
+
+    /**
+     * @brief 不透明渲染时用圆角遮罩裁剪窗口，代替透明像素。
+     */
+    void updateWindowMask();
+
+    /**
+     * @brief 帧监视开启时，按目标屏幕的刷新率监视动画的帧时间。
+     * @param animation 即将启动的动画。
+     * @param kind 动画类别。
+     */
+    void monitorFrames(QVariantAnimation *animation, ToastAnimationKind kind);
+
+    /**
+     * @brief 根据当前主题更新控件的内联样式表（或 Palette 模式下的调色板与动态属性），以改变其外观。
      */
     void updateStylesheet();
 
     /**
-     * @brief 计算 Toast 在屏幕上的最终目标位置坐标。
+     * @brief 计算 Toast 的最终目标位置坐标（位于承载者的坐标系中）。
      * @return 目标的 QPoint。
      */
     QPoint calculatePosition();
 
+    /**
+     * @brief 确定 Toast 应显示在哪个屏幕上。
+     * @return 目标屏幕，可能为 nullptr。
+     */
+    [[nodiscard]] QScreen *targetScreen() const;
+
+    /**
+     * @brief 获取 Toast 可用的定位区域：顶层窗口模式下为屏幕几何，覆盖窗口和嵌入模式下为承载控件的矩形。
+     * @return 定位区域。
+     */
+    [[nodiscard]] QRect hostArea() const;
+
+    /**
+     * @brief 覆盖窗口模式下，在位置动画开始前预留动画经过的区域，使其可以接收鼠标事件。
+     * @param from 动画起点。
+     * @param to 动画终点。
+     * @param animation 位置动画，结束时刷新覆盖窗口的遮罩。
+     */
+    void reserveHostArea(const QPoint &from, const QPoint &to, QAbstractAnimation *animation);
+
 private:
     friend class ToastManager;
+#ifdef QTTOAST_BENCHMARK
+    // 只在基准测试的编译单元中定义，安装的头文件不向使用者暴露该友元
+    friend class ToastBenchmark; ///< 基准测试需要单独测量各生命周期阶段
+#endif
+
+    /**
+     * @brief appendLine() 保留的一行日志及其测量结果。
+     */
+    struct LogLine
+    {
+        QString text;
+        QSize size; ///< 自动换行后的尺寸，无效表示尚未测量
+    };
 
     ToastConfig m_config;
+    ToastTheme m_theme; ///< 当前配置对应的主题（未注册时为临时计算结果）
     QVariant m_data;
+    quint64 m_id{0};
+    ToastHostMode m_hostMode{ToastHostMode::Window};
+    ToastPerformanceProfile m_profile{ToastPerformanceProfile::Full}; ///< 显示时生效的性能配置
+    bool m_opaque{false}; ///< 是否以不透明窗口渲染
+    int m_suspendedRemaining{-1};      ///< 暂停时剩余的显示时长（毫秒），-1 表示未在倒计时
+    bool m_suspendedDurationBar{false}; ///< 暂停时进度条是否在更新
+    bool m_hoverPaused{false};          ///< 倒计时是否因鼠标悬停而暂停
     int m_elapsedTime = 0;
+    qreal m_progress{-1}; ///< 进度条显示的进度，小于 0 时按持续时间或满格显示
+    bool m_textElided{false}; ///< 标题或正文是否因长度限制被截断
     bool m_fadingOut{false};
     bool m_used{false};
 
@@ -898,5 +947,20 @@ private:
     QWidget *m_durationBarChunk{nullptr};
     QTimer *m_durationTimer{nullptr};
     QTimer *m_durationBarTimer{nullptr};
-    std::vector<std::pair<QString, std::function<void()>>> m_buttons;
+    std::vector<ToastButton> m_buttons;
+    std::deque<LogLine> m_logLines; ///< 最近追加的日志行，超出上限时从头部丢弃
+    bool m_logFlushPending{false};  ///< 是否已安排 flushLog()
 };
+
+// ToastGlobalConfig 中只有 QWidget 后端使用的宿主控件，在此内联定义，核心库无需 QWidget 的完整定义
+
+inline QWidget *ToastGlobalConfig::hostWidget() const noexcept
+{
+    return m_hostWidget;
+}
+
+inline ToastGlobalConfig &ToastGlobalConfig::setHostWidget(QWidget *widget) noexcept
+{
+    m_hostWidget = widget;
+    return *this;
+}
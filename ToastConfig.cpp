@@ -0,0 +1,1265 @@
+#include "ToastConfig.h"
+#include "ToastConfig_p.h"
+#include <algorithm>
+#include <QDebug>
+#include <QFile>
+#include <QFileSystemWatcher>
+#include <QGuiApplication>
+#include <QTimer>
+
+const int ToastGlobalConfig::UpdatePositionDuration = 200;
+const int ToastGlobalConfig::DurationBarUpdateInterval = 5;
+const int ToastGlobalConfig::CoarseDurationBarUpdateInterval = 250;
+const int ToastGlobalConfig::DropShadowSize = 5;
+const QColor ToastGlobalConfig::SuccessAccentColor = QColor(QStringLiteral("#3e9141ff"));
+const QColor ToastGlobalConfig::WarningAccentColor = QColor(QStringLiteral("#E8B849"));
+const QColor ToastGlobalConfig::ErrorAccentColor = QColor(QStringLiteral("#BA2626"));
+const QColor ToastGlobalConfig::InformationAccentColor = QColor(QStringLiteral("#007FFF"));
+const QColor ToastGlobalConfig::DefaultAccentColor = QColor(QStringLiteral("#5C5C5C"));
+const QColor ToastGlobalConfig::DefaultBackgroundColor = QColor(QStringLiteral("#E7F4F9"));
+const QColor ToastGlobalConfig::DefaultTitleColor = QColor(QStringLiteral("#000000"));
+const QColor ToastGlobalConfig::DefaultTextColor = QColor(QStringLiteral("#5C5C5C"));
+const QColor ToastGlobalConfig::DefaultIconSeparatorColor = QColor(QStringLiteral("#D9D9D9"));
+const QColor ToastGlobalConfig::DefaultCloseButtonIconColor = QColor(QStringLiteral("#000000"));
+const QColor ToastGlobalConfig::DefaultBackgroundColorDark = QColor(QStringLiteral("#292929"));
+const QColor ToastGlobalConfig::DefaultTitleColorDark = QColor(QStringLiteral("#FFFFFF"));
+const QColor ToastGlobalConfig::DefaultTextColorDark = QColor(QStringLiteral("#D0D0D0"));
+const QColor ToastGlobalConfig::DefaultIconSeparatorColorDark = QColor(QStringLiteral("#585858"));
+const QColor ToastGlobalConfig::DefaultCloseButtonIconColorDark = QColor(QStringLiteral("#C9C9C9"));
+
+namespace {
+/**
+ * @brief 检测运行环境：在远程会话中每次窗口移动与不透明度变化都会变成一次网络往返和整窗重绘。
+ */
+ToastPerformanceProfile detectPerformanceProfile()
+{
+    const QByteArray forced = qgetenv("QTTOAST_PERFORMANCE_PROFILE").trimmed().toLower();
+    if (forced == "minimal") {
+        return ToastPerformanceProfile::Minimal;
+    }
+    if (forced == "full") {
+        return ToastPerformanceProfile::Full;
+    }
+    if (QGuiApplication::platformName() == QLatin1String("vnc")) {
+        return ToastPerformanceProfile::Minimal;
+    }
+    // 本地 X11 显示形如 ":0"，经 SSH 转发或 TCP 连接的显示带有主机名，例如 "localhost:10.0"
+    const QString display = qEnvironmentVariable("DISPLAY");
+    const int colon = display.lastIndexOf(QLatin1Char(':'));
+    const QString displayHost = colon > 0 ? display.left(colon) : QString();
+    if (QGuiApplication::platformName() == QLatin1String("xcb") && !displayHost.isEmpty()
+        && displayHost != QLatin1String("unix")) {
+        return ToastPerformanceProfile::Minimal;
+    }
+    if (qEnvironmentVariable("SESSIONNAME").startsWith(QLatin1String("RDP-"))) {
+        return ToastPerformanceProfile::Minimal;
+    }
+    return ToastPerformanceProfile::Full;
+}
+
+/**
+ * @brief 这些平台插件没有窗口合成器，半透明窗口要么需要软件 alpha 混合，要么显示不正确。
+ */
+bool isNonCompositingPlatform()
+{
+    static const QStringList s_platforms{
+        QStringLiteral("linuxfb"),
+        QStringLiteral("eglfs"),
+        QStringLiteral("offscreen"),
+        QStringLiteral("minimal"),
+        QStringLiteral("vnc"),
+        QStringLiteral("directfb")};
+    return s_platforms.contains(QGuiApplication::platformName());
+}
+} // namespace
+
+ToastGlobalConfig &ToastGlobalConfig::instance() noexcept
+{
+    static ToastGlobalConfig s_instance;
+    return s_instance;
+}
+
+int ToastGlobalConfig::maximumOnScreen() const noexcept
+{
+    return m_maximumOnScreen;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setMaximumOnScreen(int maximum) noexcept
+{
+    m_maximumOnScreen = maximum;
+    return *this;
+}
+
+int ToastGlobalConfig::spacing() const noexcept
+{
+    return m_spacing;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setSpacing(int spacing) noexcept
+{
+    m_spacing = spacing;
+    return *this;
+}
+
+int ToastGlobalConfig::offsetY() const noexcept
+{
+    return m_offsetY;
+}
+
+int ToastGlobalConfig::offsetX() const noexcept
+{
+    return m_offsetX;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setOffset(int x, int y) noexcept
+{
+    m_offsetX = x;
+    m_offsetY = y;
+    return *this;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setOffsetX(int offsetX) noexcept
+{
+    m_offsetX = offsetX;
+    return *this;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setOffsetY(int offsetY) noexcept
+{
+    m_offsetY = offsetY;
+    return *this;
+}
+
+bool ToastGlobalConfig::alwaysOnMainScreen() const noexcept
+{
+    return m_alwaysOnMainScreen;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setAlwaysOnMainScreen(bool enabled) noexcept
+{
+    m_alwaysOnMainScreen = enabled;
+    return *this;
+}
+
+QScreen *ToastGlobalConfig::fixedScreen() const noexcept
+{
+    return m_fixedScreen;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setFixedScreen(QScreen *screen) noexcept
+{
+    m_fixedScreen = screen;
+    return *this;
+}
+
+ToastPosition ToastGlobalConfig::position() const noexcept
+{
+    return m_position;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setPosition(ToastPosition position) noexcept
+{
+    m_position = position;
+    return *this;
+}
+
+ToastHostMode ToastGlobalConfig::hostMode() const noexcept
+{
+    return m_hostMode;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setHostMode(ToastHostMode mode) noexcept
+{
+    m_hostMode = mode;
+    return *this;
+}
+
+
+ToastStyleMode ToastGlobalConfig::styleMode() const noexcept
+{
+    return m_styleMode;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setStyleMode(ToastStyleMode mode) noexcept
+{
+    m_styleMode = mode;
+    return *this;
+}
+
+ToastPerformanceProfile ToastGlobalConfig::performanceProfile() const noexcept
+{
+    return m_performanceProfile;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setPerformanceProfile(
+    ToastPerformanceProfile profile) noexcept
+{
+    m_performanceProfile = profile;
+    return *this;
+}
+
+ToastPerformanceProfile ToastGlobalConfig::effectivePerformanceProfile() const
+{
+    if (m_performanceProfile != ToastPerformanceProfile::Auto) {
+        return m_performanceProfile;
+    }
+    static const ToastPerformanceProfile s_detected = detectPerformanceProfile();
+    return s_detected;
+}
+
+ToastRenderMode ToastGlobalConfig::renderMode() const noexcept
+{
+    return m_renderMode;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setRenderMode(ToastRenderMode mode) noexcept
+{
+    m_renderMode = mode;
+    return *this;
+}
+
+ToastRenderMode ToastGlobalConfig::effectiveRenderMode() const
+{
+    if (m_renderMode != ToastRenderMode::Auto) {
+        return m_renderMode;
+    }
+    if (effectivePerformanceProfile() == ToastPerformanceProfile::Minimal
+        || isNonCompositingPlatform()) {
+        return ToastRenderMode::Opaque;
+    }
+    return ToastRenderMode::Translucent;
+}
+
+const QColor &ToastGlobalConfig::backdropColor() const noexcept
+{
+    return m_backdropColor;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setBackdropColor(const QColor &color) noexcept
+{
+    m_backdropColor = color;
+    return *this;
+}
+
+const QString &ToastGlobalConfig::styleSheet() const
+{
+    if (!m_styleSheetLoaded) {
+        qtToastInitResources();
+        QFile file(":/css/toast.css");
+        file.open(QFile::ReadOnly);
+        m_styleSheet = QString::fromUtf8(file.readAll());
+        m_styleSheetLoaded = true;
+    }
+    return m_styleSheet;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setStyleSheet(const QString &styleSheet)
+{
+    m_styleSheet = styleSheet;
+    m_styleSheetLoaded = !styleSheet.isEmpty();
+    if (m_styleSheetChanged) {
+        m_styleSheetChanged();
+    }
+    return *this;
+}
+
+ToastGlobalConfig &ToastGlobalConfig::setStyleSheetFile(const QString &path)
+{
+    if (m_styleSheetWatcher && !m_styleSheetFile.isEmpty()) {
+        m_styleSheetWatcher->removePath(m_styleSheetFile);
+    }
+    m_styleSheetFile = path;
+    if (path.isEmpty()) {
+        return setStyleSheet(QString());
+    }
+    if (m_styleSheetWatcher == nullptr) {
+        // 以 qApp 为父对象，随应用程序一同销毁
+        m_styleSheetWatcher = new QFileSystemWatcher(qApp);
+        QObject::connect(
+            m_styleSheetWatcher, &QFileSystemWatcher::fileChanged, m_styleSheetWatcher, [this]() {
+                // 编辑器保存时可能连续触发多次，合并为一次重新加载
+                if (m_styleSheetReloadPending) {
+                    return;
+                }
+                m_styleSheetReloadPending = true;
+                QTimer::singleShot(0, m_styleSheetWatcher, [this]() { reloadStyleSheetFile(); });
+            });
+    }
+    reloadStyleSheetFile();
+    return *this;
+}
+
+const QString &ToastGlobalConfig::styleSheetFile() const noexcept
+{
+    return m_styleSheetFile;
+}
+
+void ToastGlobalConfig::reloadStyleSheetFile()
+{
+    m_styleSheetReloadPending = false;
+    if (m_styleSheetFile.isEmpty()) {
+        return;
+    }
+    // 许多编辑器以“删除后重命名”的方式保存文件，此时需要重新加入监视
+    if (m_styleSheetWatcher && !m_styleSheetWatcher->files().contains(m_styleSheetFile)) {
+        m_styleSheetWatcher->addPath(m_styleSheetFile);
+    }
+    QFile file(m_styleSheetFile);
+    if (!file.open(QFile::ReadOnly)) {
+        qWarning() << "Failed to load toast stylesheet:" << m_styleSheetFile;
+        return;
+    }
+    setStyleSheet(QString::fromUtf8(file.readAll()));
+}
+
+void qtToastInitResources()
+{
+    static const bool s_initialized = []() {
+        Q_INIT_RESOURCE(resources);
+        return true;
+    }();
+    Q_UNUSED(s_initialized)
+}
+
+QPixmap ToastConfig::getIconFromEnum(ToastIcon enumIcon) noexcept
+{
+    qtToastInitResources();
+    if (enumIcon == ToastIcon::Success) {
+        return QPixmap(":/icons/success.png");
+    } else if (enumIcon == ToastIcon::Warning) {
+        return QPixmap(":/icons/warning.png");
+    } else if (enumIcon == ToastIcon::Error) {
+        return QPixmap(":/icons/error.png");
+    } else if (enumIcon == ToastIcon::Information) {
+        return QPixmap(":/icons/information.png");
+    } else if (enumIcon == ToastIcon::Close) {
+        return QPixmap(":/icons/close.png");
+    }
+    return QPixmap();
+}
+
+QImage ToastConfig::recolorImage(QImage image, const QColor &color) noexcept
+{
+    // Loop through every pixel
+    for (int x = 0; x < image.width(); x++) {
+        for (int y = 0; y < image.height(); y++) {
+            // Get current color of the pixel
+            QColor currentColor = image.pixelColor(x, y);
+
+            // Replace the rgb values with rgb of new color and keep alpha the same
+            QColor newColor = QColor::fromRgba(
+                qRgba(color.red(), color.green(), color.blue(), currentColor.alpha()));
+            image.setPixelColor(x, y, newColor);
+        }
+    }
+    return image;
+}
+
+namespace {
+const QSharedDataPointer<ToastStyleData> &defaultStyle() noexcept
+{
+    static const QSharedDataPointer<ToastStyleData> s_style(new ToastStyleData);
+    return s_style;
+}
+
+QSharedDataPointer<ToastStyleData> makePresetStyle(ToastPreset preset)
+{
+    QSharedDataPointer<ToastStyleData> style(new ToastStyleData);
+    if (preset == ToastPreset::Success || preset == ToastPreset::SuccessDark) {
+        style->icon = ToastIcon::Success;
+        style->iconColor = ToastGlobalConfig::SuccessAccentColor;
+        style->durationBarColor = ToastGlobalConfig::SuccessAccentColor;
+    } else if (preset == ToastPreset::Warning || preset == ToastPreset::WarningDark) {
+        style->icon = ToastIcon::Warning;
+        style->iconColor = ToastGlobalConfig::WarningAccentColor;
+        style->durationBarColor = ToastGlobalConfig::WarningAccentColor;
+    } else if (preset == ToastPreset::Error || preset == ToastPreset::ErrorDark) {
+        style->icon = ToastIcon::Error;
+        style->iconColor = ToastGlobalConfig::ErrorAccentColor;
+        style->durationBarColor = ToastGlobalConfig::ErrorAccentColor;
+    } else if (preset == ToastPreset::Information || preset == ToastPreset::InformationDark) {
+        style->icon = ToastIcon::Information;
+        style->iconColor = ToastGlobalConfig::InformationAccentColor;
+        style->durationBarColor = ToastGlobalConfig::InformationAccentColor;
+    }
+
+    if (preset == ToastPreset::SuccessDark || preset == ToastPreset::WarningDark
+        || preset == ToastPreset::ErrorDark || preset == ToastPreset::InformationDark) {
+        style->backgroundColor = ToastGlobalConfig::DefaultBackgroundColorDark;
+        style->closeButtonIconColor = ToastGlobalConfig::DefaultCloseButtonIconColorDark;
+        style->iconSeparatorColor = ToastGlobalConfig::DefaultIconSeparatorColorDark;
+        style->titleColor = ToastGlobalConfig::DefaultTitleColorDark;
+        style->textColor = ToastGlobalConfig::DefaultTextColorDark;
+    }
+    style->showDurationBar = true;
+    style->showIcon = true;
+    style->showIconSeparator = true;
+    style->iconSeparatorWidth = 2;
+    return style;
+}
+
+QIcon tintedIcon(const QPixmap &pixmap, const QSize &size, const QColor &color)
+{
+    auto image = ToastConfig::recolorImage(QIcon(pixmap).pixmap(size).toImage(), color);
+    return QIcon(QPixmap::fromImage(image));
+}
+
+std::shared_ptr<const ToastThemeData> buildThemeData(
+    const QString &name, const QSharedDataPointer<ToastStyleData> &style)
+{
+    auto data = std::make_shared<ToastThemeData>();
+    const ToastStyleData &st = *style.constData();
+    data->name = name;
+    data->style = style;
+
+    // 派生颜色
+    data->buttonColor = st.backgroundColor.darker(120);
+    data->buttonBorderColor = st.backgroundColor.darker(150);
+    data->buttonHoverColor = st.backgroundColor.darker(130);
+    data->buttonPressedColor = st.backgroundColor.darker(160);
+
+    // 调色板
+    data->palette.setColor(QPalette::Window, st.backgroundColor);
+    data->palette.setColor(QPalette::Base, st.backgroundColor);
+    data->palette.setColor(QPalette::WindowText, st.titleColor);
+    data->palette.setColor(QPalette::Text, st.textColor);
+    data->palette.setColor(QPalette::Button, data->buttonColor);
+    data->palette.setColor(QPalette::ButtonText, st.textColor);
+    data->palette.setColor(QPalette::Mid, st.iconSeparatorColor);
+    data->palette.setColor(QPalette::Highlight, st.durationBarColor);
+
+    // 着色后的图标
+    const QPixmap icon = st.customIcon.isNull() ? ToastConfig::getIconFromEnum(st.icon)
+                                                : st.customIcon;
+    data->icon = tintedIcon(icon, st.iconSize, st.iconColor);
+    const QPixmap closeIcon = st.customCloseButtonIcon.isNull()
+                                  ? ToastConfig::getIconFromEnum(st.closeButtonIcon)
+                                  : st.customCloseButtonIcon;
+    data->closeButtonIcon = tintedIcon(closeIcon, st.closeButtonIconSize, st.closeButtonIconColor);
+
+    // 样式表
+    data->notificationStyleSheet = QString(
+                                       "background: %1;"
+                                       "border-radius: %2px; ")
+                                       .arg(st.backgroundColor.name())
+                                       .arg(st.borderRadius);
+    data->durationBarStyleSheet = QString(
+                                      "background: rgba(%1, %2, %3, 100);"
+                                      "border-radius: %4px;")
+                                      .arg(st.durationBarColor.red())
+                                      .arg(st.durationBarColor.green())
+                                      .arg(st.durationBarColor.blue())
+                                      .arg(st.borderRadius);
+    const QString chunk = QString(
+                              "background: rgba(%1, %2, %3, 255);"
+                              "border-bottom-left-radius: %4px; border-bottom-right-radius: %5px;")
+                              .arg(st.durationBarColor.red())
+                              .arg(st.durationBarColor.green())
+                              .arg(st.durationBarColor.blue())
+                              .arg(st.borderRadius);
+    data->durationBarChunkStyleSheet = chunk.arg(0);
+    data->durationBarChunkStyleSheetInfinite = chunk.arg(st.borderRadius);
+    data->iconSeparatorStyleSheet = QString("background: %1;").arg(st.iconSeparatorColor.name());
+    data->titleStyleSheet = QString("color: %1;").arg(st.titleColor.name());
+    data->textStyleSheet = QString("color: %1;").arg(st.textColor.name());
+    data->buttonStyleSheet = QString(
+                                 "QPushButton {"
+                                 "    background-color: %1;"
+                                 "    color: %2;"
+                                 "    border: 1px solid %3;"
+                                 "    border-radius: 4px;"
+                                 "    padding: 4px 12px;"
+                                 "    font-family: %4;"
+                                 "    font-size: %5pt;"
+                                 "}"
+                                 "QPushButton:hover {"
+                                 "    background-color: %6;"
+                                 "}"
+                                 "QPushButton:pressed {"
+                                 "    background-color: %7;"
+                                 "}")
+                                 .arg(data->buttonColor.name())
+                                 .arg(st.textColor.name())
+                                 .arg(data->buttonBorderColor.name())
+                                 .arg(st.textFont.family())
+                                 .arg(st.textFont.pointSize())
+                                 .arg(data->buttonHoverColor.name())
+                                 .arg(data->buttonPressedColor.name());
+
+    // Palette 模式的调色板，颜色角色与 paletteModeStyleSheet() 中的 palette() 引用一一对应
+    auto windowPalette = [](const QColor &color) {
+        QPalette palette;
+        palette.setColor(QPalette::Window, color);
+        return palette;
+    };
+    auto textPalette = [](const QColor &color) {
+        QPalette palette;
+        palette.setColor(QPalette::WindowText, color);
+        return palette;
+    };
+    QColor durationBarColor = st.durationBarColor;
+    durationBarColor.setAlpha(100);
+    data->notificationPalette = windowPalette(st.backgroundColor);
+    data->durationBarPalette = windowPalette(durationBarColor);
+    data->durationBarChunkPalette = windowPalette(st.durationBarColor);
+    data->iconSeparatorPalette = windowPalette(st.iconSeparatorColor);
+    data->titlePalette = textPalette(st.titleColor);
+    data->textPalette = textPalette(st.textColor);
+    data->buttonPalette.setColor(QPalette::Button, data->buttonColor);
+    data->buttonPalette.setColor(QPalette::ButtonText, st.textColor);
+    data->buttonPalette.setColor(QPalette::Dark, data->buttonBorderColor);
+    data->buttonPalette.setColor(QPalette::Midlight, data->buttonHoverColor);
+    data->buttonPalette.setColor(QPalette::Shadow, data->buttonPressedColor);
+    return data;
+}
+
+const QSharedDataPointer<ToastConfigData> &defaultConfigData() noexcept
+{
+    static const QSharedDataPointer<ToastConfigData> s_data = []() {
+        QSharedDataPointer<ToastConfigData> data(new ToastConfigData);
+        data->style = defaultStyle();
+        return data;
+    }();
+    return s_data;
+}
+
+template<typename T>
+void setStyleField(QSharedDataPointer<ToastConfigData> &d, T ToastStyleData::*field, const T &value)
+{
+    // 值未改变时不分离共享数据
+    if (d.constData()->style.constData()->*field == value) {
+        return;
+    }
+    d->style.data()->*field = value;
+}
+} // namespace
+
+ToastConfig::ToastConfig()
+    : d(defaultConfigData())
+{}
+
+ToastConfig::ToastConfig(const ToastConfig &other) = default;
+ToastConfig::ToastConfig(ToastConfig &&other) noexcept = default;
+ToastConfig &ToastConfig::operator=(const ToastConfig &other) = default;
+ToastConfig &ToastConfig::operator=(ToastConfig &&other) noexcept = default;
+ToastConfig::~ToastConfig() = default;
+
+ToastConfig &ToastConfig::setPreset(ToastPreset preset) noexcept
+{
+    const auto &registry = ToastThemeRegistry::instance();
+    const ToastTheme presetTheme = registry.preset(preset);
+    const ToastTheme current = theme();
+    if (!current.isNull() && registry.isBuiltIn(current)) {
+        // 仍是默认外观或另一个预设：直接共享预设主题，无需逐项复制
+        return setTheme(presetTheme);
+    }
+    // 引用已注册主题或已自定义外观：只覆盖预设涉及的字段，保留字体、边距等其余项
+    const ToastStyleData &base = *presetTheme.d->style.constData();
+    auto *style = d->style.data();
+    style->icon = base.icon;
+    style->customIcon = QPixmap();
+    style->iconColor = base.iconColor;
+    style->durationBarColor = base.durationBarColor;
+    style->backgroundColor = base.backgroundColor;
+    style->closeButtonIconColor = base.closeButtonIconColor;
+    style->iconSeparatorColor = base.iconSeparatorColor;
+    style->titleColor = base.titleColor;
+    style->textColor = base.textColor;
+    style->showDurationBar = base.showDurationBar;
+    style->showIcon = base.showIcon;
+    style->showIconSeparator = base.showIconSeparator;
+    style->iconSeparatorWidth = base.iconSeparatorWidth;
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTheme(const ToastTheme &theme) noexcept
+{
+    if (theme.isNull()) {
+        return *this;
+    }
+    d->style = theme.d->style;
+    d->theme = theme;
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTheme(const QString &name) noexcept
+{
+    return setTheme(ToastThemeRegistry::instance().theme(name));
+}
+
+ToastTheme ToastConfig::theme() const noexcept
+{
+    if (d->style.constData() == defaultStyle().constData()) {
+        return ToastThemeRegistry::instance().defaultTheme();
+    }
+    const auto &theme = d->theme;
+    if (theme.isNull() || theme.d->style.constData() != d->style.constData()) {
+        return ToastTheme();
+    }
+    return theme;
+}
+
+ToastConfig &ToastConfig::setDuration(int duration) noexcept
+{
+    if (d.constData()->duration != duration) {
+        d->duration = duration;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setQueueTimeToLive(int timeToLive) noexcept
+{
+    if (d.constData()->queueTimeToLive != timeToLive) {
+        d->queueTimeToLive = timeToLive;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setExpiresAt(const QDateTime &expiresAt) noexcept
+{
+    if (d.constData()->expiresAt != expiresAt) {
+        d->expiresAt = expiresAt;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setShowDurationBar(bool enabled) noexcept
+{
+    setStyleField(d, &ToastStyleData::showDurationBar, enabled);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTitle(const QString &title) noexcept
+{
+    if (d.constData()->title != title) {
+        d->title = title;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setText(const QString &text) noexcept
+{
+    if (d.constData()->text != text) {
+        d->text = text;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setLogLineLimit(int limit) noexcept
+{
+    limit = std::max(1, limit);
+    if (d.constData()->logLineLimit != limit) {
+        d->logLineLimit = limit;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTextCharacterLimit(int limit) noexcept
+{
+    limit = std::max(0, limit);
+    if (d.constData()->textCharacterLimit != limit) {
+        d->textCharacterLimit = limit;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTextLineLimit(int limit) noexcept
+{
+    limit = std::max(0, limit);
+    if (d.constData()->textLineLimit != limit) {
+        d->textLineLimit = limit;
+    }
+    return *this;
+}
+
+QString ToastConfig::elidedText(
+    const QString &text, int characterLimit, int lineLimit, bool *elided)
+{
+    if (elided != nullptr) {
+        *elided = false;
+    }
+    qsizetype end = text.size();
+    if (characterLimit > 0) {
+        end = std::min<qsizetype>(end, characterLimit);
+    }
+    if (lineLimit > 0) {
+        int lines = 1;
+        for (qsizetype i = 0; i < end; i++) {
+            if (text.at(i) == QLatin1Char('\n') && ++lines > lineLimit) {
+                end = i;
+                break;
+            }
+        }
+    }
+    if (end >= text.size()) {
+        return text;
+    }
+    // 不拆开代理对
+    if (end > 0 && text.at(end - 1).isHighSurrogate()) {
+        end--;
+    }
+    if (elided != nullptr) {
+        *elided = true;
+    }
+    QString bounded = text.left(end);
+    bounded.append(QChar(0x2026));
+    return bounded;
+}
+
+ToastConfig &ToastConfig::setIcon(const QPixmap &icon) noexcept
+{
+    d->style.data()->customIcon = icon;
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIcon(ToastIcon icon) noexcept
+{
+    const auto *style = d.constData()->style.constData();
+    if (style->icon == icon && style->customIcon.isNull()) {
+        return *this;
+    }
+    auto *mutableStyle = d->style.data();
+    mutableStyle->icon = icon;
+    mutableStyle->customIcon = QPixmap();
+    return *this;
+}
+
+ToastConfig &ToastConfig::setShowIcon(bool enabled) noexcept
+{
+    setStyleField(d, &ToastStyleData::showIcon, enabled);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIconSize(const QSize &size) noexcept
+{
+    setStyleField(d, &ToastStyleData::iconSize, size);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setShowIconSeparator(bool enabled) noexcept
+{
+    setStyleField(d, &ToastStyleData::showIconSeparator, enabled);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIconSeparatorWidth(int width) noexcept
+{
+    setStyleField(d, &ToastStyleData::iconSeparatorWidth, width);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonIcon(const QPixmap &icon) noexcept
+{
+    d->style.data()->customCloseButtonIcon = icon;
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonIcon(ToastIcon icon) noexcept
+{
+    const auto *style = d.constData()->style.constData();
+    if (style->closeButtonIcon == icon && style->customCloseButtonIcon.isNull()) {
+        return *this;
+    }
+    auto *mutableStyle = d->style.data();
+    mutableStyle->closeButtonIcon = icon;
+    mutableStyle->customCloseButtonIcon = QPixmap();
+    return *this;
+}
+
+ToastConfig &ToastConfig::setShowCloseButton(bool enabled) noexcept
+{
+    setStyleField(d, &ToastStyleData::showCloseButton, enabled);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonIconSize(const QSize &size) noexcept
+{
+    setStyleField(d, &ToastStyleData::closeButtonIconSize, size);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonSize(const QSize &size) noexcept
+{
+    setStyleField(d, &ToastStyleData::closeButtonSize, size);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonAlignment(ToastButtonAlignment alignment) noexcept
+{
+    setStyleField(d, &ToastStyleData::closeButtonAlignment, alignment);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setFadeInDuration(int duration) noexcept
+{
+    setStyleField(d, &ToastStyleData::fadeInDuration, duration);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setFadeOutDuration(int duration) noexcept
+{
+    setStyleField(d, &ToastStyleData::fadeOutDuration, duration);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setResetDurationOnHover(bool enabled) noexcept
+{
+    if (d.constData()->resetDurationOnHover != enabled) {
+        d->resetDurationOnHover = enabled;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setStayOnTop(bool enabled) noexcept
+{
+    if (d.constData()->stayOnTop != enabled) {
+        d->stayOnTop = enabled;
+    }
+    return *this;
+}
+
+ToastConfig &ToastConfig::setBorderRadius(int borderRadius) noexcept
+{
+    setStyleField(d, &ToastStyleData::borderRadius, borderRadius);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setBackgroundColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::backgroundColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTitleColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::titleColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTextColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::textColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIconColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::iconColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIconSeparatorColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::iconSeparatorColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonIconColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::closeButtonIconColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setDurationBarColor(const QColor &color) noexcept
+{
+    setStyleField(d, &ToastStyleData::durationBarColor, color);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTitleFont(const QFont &font) noexcept
+{
+    setStyleField(d, &ToastStyleData::titleFont, font);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTextFont(const QFont &font) noexcept
+{
+    setStyleField(d, &ToastStyleData::textFont, font);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setMargins(const QMargins &margins) noexcept
+{
+    setStyleField(d, &ToastStyleData::margins, margins);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIconMargins(const QMargins &margins) noexcept
+{
+    setStyleField(d, &ToastStyleData::iconMargins, margins);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setIconSectionMargins(const QMargins &margins) noexcept
+{
+    setStyleField(d, &ToastStyleData::iconSectionMargins, margins);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTextSectionMargins(const QMargins &margins) noexcept
+{
+    setStyleField(d, &ToastStyleData::textSectionMargins, margins);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setCloseButtonMargins(const QMargins &margins) noexcept
+{
+    setStyleField(d, &ToastStyleData::closeButtonMargins, margins);
+    return *this;
+}
+
+ToastConfig &ToastConfig::setTextSectionSpacing(int spacing) noexcept
+{
+    setStyleField(d, &ToastStyleData::textSectionSpacing, spacing);
+    return *this;
+}
+
+int ToastConfig::duration() const noexcept
+{
+    return d->duration;
+}
+
+int ToastConfig::queueTimeToLive() const noexcept
+{
+    return d->queueTimeToLive;
+}
+
+const QDateTime &ToastConfig::expiresAt() const noexcept
+{
+    return d->expiresAt;
+}
+
+bool ToastConfig::isExpired(qint64 queuedFor) const
+{
+    if (d->queueTimeToLive > 0 && queuedFor > static_cast<qint64>(d->queueTimeToLive) * 1000) {
+        return true;
+    }
+    return d->expiresAt.isValid() && QDateTime::currentDateTimeUtc() >= d->expiresAt;
+}
+
+bool ToastConfig::showDurationBar() const noexcept
+{
+    return d->style->showDurationBar;
+}
+
+const QString &ToastConfig::text() const noexcept
+{
+    return d->text;
+}
+
+int ToastConfig::logLineLimit() const noexcept
+{
+    return d->logLineLimit;
+}
+
+int ToastConfig::textCharacterLimit() const noexcept
+{
+    return d->textCharacterLimit;
+}
+
+int ToastConfig::textLineLimit() const noexcept
+{
+    return d->textLineLimit;
+}
+
+const QString &ToastConfig::title() const noexcept
+{
+    return d->title;
+}
+
+QPixmap ToastConfig::icon() const noexcept
+{
+    const auto *style = d->style.constData();
+    return style->customIcon.isNull() ? getIconFromEnum(style->icon) : style->customIcon;
+}
+
+ToastIcon ToastConfig::iconType() const noexcept
+{
+    return d->style->icon;
+}
+
+bool ToastConfig::showIcon() const noexcept
+{
+    return d->style->showIcon;
+}
+
+const QSize &ToastConfig::iconSize() const noexcept
+{
+    return d->style->iconSize;
+}
+
+bool ToastConfig::showIconSeparator() const noexcept
+{
+    return d->style->showIconSeparator;
+}
+
+int ToastConfig::iconSeparatorWidth() const noexcept
+{
+    return d->style->iconSeparatorWidth;
+}
+
+QPixmap ToastConfig::closeButtonIcon() const noexcept
+{
+    const auto *style = d->style.constData();
+    return style->customCloseButtonIcon.isNull() ? getIconFromEnum(style->closeButtonIcon)
+                                                 : style->customCloseButtonIcon;
+}
+
+bool ToastConfig::showCloseButton() const noexcept
+{
+    return d->style->showCloseButton;
+}
+
+const QSize &ToastConfig::closeButtonIconSize() const noexcept
+{
+    return d->style->closeButtonIconSize;
+}
+
+const QSize &ToastConfig::closeButtonSize() const noexcept
+{
+    return d->style->closeButtonSize;
+}
+
+ToastButtonAlignment ToastConfig::closeButtonAlignment() const noexcept
+{
+    return d->style->closeButtonAlignment;
+}
+
+int ToastConfig::fadeInDuration() const noexcept
+{
+    return d->style->fadeInDuration;
+}
+
+int ToastConfig::fadeOutDuration() const noexcept
+{
+    return d->style->fadeOutDuration;
+}
+
+bool ToastConfig::resetDurationOnHover() const noexcept
+{
+    return d->resetDurationOnHover;
+}
+
+bool ToastConfig::stayOnTop() const noexcept
+{
+    return d->stayOnTop;
+}
+
+int ToastConfig::borderRadius() const noexcept
+{
+    return d->style->borderRadius;
+}
+
+const QColor &ToastConfig::backgroundColor() const noexcept
+{
+    return d->style->backgroundColor;
+}
+
+const QColor &ToastConfig::titleColor() const noexcept
+{
+    return d->style->titleColor;
+}
+
+const QColor &ToastConfig::textColor() const noexcept
+{
+    return d->style->textColor;
+}
+
+const QColor &ToastConfig::iconColor() const noexcept
+{
+    return d->style->iconColor;
+}
+
+const QColor &ToastConfig::iconSeparatorColor() const noexcept
+{
+    return d->style->iconSeparatorColor;
+}
+
+const QColor &ToastConfig::closeButtonIconColor() const noexcept
+{
+    return d->style->closeButtonIconColor;
+}
+
+const QColor &ToastConfig::durationBarColor() const noexcept
+{
+    return d->style->durationBarColor;
+}
+
+const QFont &ToastConfig::titleFont() const noexcept
+{
+    return d->style->titleFont;
+}
+
+const QFont &ToastConfig::textFont() const noexcept
+{
+    return d->style->textFont;
+}
+
+const QMargins &ToastConfig::margins() const noexcept
+{
+    return d->style->margins;
+}
+
+const QMargins &ToastConfig::iconMargins() const noexcept
+{
+    return d->style->iconMargins;
+}
+
+const QMargins &ToastConfig::iconSectionMargins() const noexcept
+{
+    return d->style->iconSectionMargins;
+}
+
+const QMargins &ToastConfig::textSectionMargins() const noexcept
+{
+    return d->style->textSectionMargins;
+}
+
+const QMargins &ToastConfig::closeButtonMargins() const noexcept
+{
+    return d->style->closeButtonMargins;
+}
+
+int ToastConfig::textSectionSpacing() const noexcept
+{
+    return d->style->textSectionSpacing;
+}
+
+ToastTheme::ToastTheme(std::shared_ptr<const ToastThemeData> data) noexcept
+    : d(std::move(data))
+{}
+
+ToastTheme ToastTheme::fromConfig(const ToastConfig &config)
+{
+    return ToastTheme(buildThemeData(QString(), config.d->style));
+}
+
+bool ToastTheme::isNull() const noexcept
+{
+    return d == nullptr;
+}
+
+const QString &ToastTheme::name() const noexcept
+{
+    static const QString s_empty;
+    return d ? d->name : s_empty;
+}
+
+const QPalette &ToastTheme::palette() const noexcept
+{
+    static const QPalette s_empty;
+    return d ? d->palette : s_empty;
+}
+
+const QIcon &ToastTheme::icon() const noexcept
+{
+    static const QIcon s_empty;
+    return d ? d->icon : s_empty;
+}
+
+const QIcon &ToastTheme::closeButtonIcon() const noexcept
+{
+    static const QIcon s_empty;
+    return d ? d->closeButtonIcon : s_empty;
+}
+
+const QColor &ToastTheme::buttonColor() const noexcept
+{
+    static const QColor s_empty;
+    return d ? d->buttonColor : s_empty;
+}
+
+const QColor &ToastTheme::buttonBorderColor() const noexcept
+{
+    static const QColor s_empty;
+    return d ? d->buttonBorderColor : s_empty;
+}
+
+const QColor &ToastTheme::buttonHoverColor() const noexcept
+{
+    static const QColor s_empty;
+    return d ? d->buttonHoverColor : s_empty;
+}
+
+const QColor &ToastTheme::buttonPressedColor() const noexcept
+{
+    static const QColor s_empty;
+    return d ? d->buttonPressedColor : s_empty;
+}
+
+bool ToastTheme::operator==(const ToastTheme &other) const noexcept
+{
+    return d == other.d;
+}
+
+bool ToastTheme::operator!=(const ToastTheme &other) const noexcept
+{
+    return d != other.d;
+}
+
+ToastThemeRegistry &ToastThemeRegistry::instance() noexcept
+{
+    static ToastThemeRegistry s_instance;
+    return s_instance;
+}
+
+ToastThemeRegistry::ToastThemeRegistry()
+    : m_default(buildThemeData(QStringLiteral("default"), defaultStyle()))
+{
+    m_themes.insert(m_default.name(), m_default);
+    const std::array<std::pair<ToastPreset, const char *>, 8> presets{{
+        {ToastPreset::Success, "success"},
+        {ToastPreset::Warning, "warning"},
+        {ToastPreset::Error, "error"},
+        {ToastPreset::Information, "information"},
+        {ToastPreset::SuccessDark, "success-dark"},
+        {ToastPreset::WarningDark, "warning-dark"},
+        {ToastPreset::ErrorDark, "error-dark"},
+        {ToastPreset::InformationDark, "information-dark"},
+    }};
+    for (const auto &[preset, name] : presets) {
+        ToastTheme theme(buildThemeData(QString::fromLatin1(name), makePresetStyle(preset)));
+        m_presets.at(static_cast<size_t>(preset)) = theme;
+        m_themes.insert(theme.name(), theme);
+    }
+}
+
+ToastTheme ToastThemeRegistry::registerTheme(const QString &name, const ToastConfig &appearance)
+{
+    // 复制一份独立的外观基础，避免与其他主题共享同一实例
+    QSharedDataPointer<ToastStyleData> style(new ToastStyleData(*appearance.d->style.constData()));
+    ToastTheme theme(buildThemeData(name, style));
+    m_themes.insert(name, theme);
+    return theme;
+}
+
+bool ToastThemeRegistry::unregisterTheme(const QString &name) noexcept
+{
+    return m_themes.remove(name) > 0;
+}
+
+ToastTheme ToastThemeRegistry::theme(const QString &name) const noexcept
+{
+    return m_themes.value(name);
+}
+
+ToastTheme ToastThemeRegistry::preset(ToastPreset preset) const noexcept
+{
+    return m_presets.at(static_cast<size_t>(preset));
+}
+
+ToastTheme ToastThemeRegistry::defaultTheme() const noexcept
+{
+    return m_default;
+}
+
+bool ToastThemeRegistry::isBuiltIn(const ToastTheme &theme) const noexcept
+{
+    return theme == m_default
+           || std::find(m_presets.begin(), m_presets.end(), theme) != m_presets.end();
+}
+
+QStringList ToastThemeRegistry::names() const
+{
+    return m_themes.keys();
+}
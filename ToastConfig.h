@@ -0,0 +1,916 @@
+#pragma once
+
+#include "ToastGlobal.h"
+#include <array>
+#include <functional>
+#include <memory>
+#include <QColor>
+#include <QDateTime>
+#include <QFont>
+#include <QHash>
+#include <QIcon>
+#include <QImage>
+#include <QMargins>
+#include <QPalette>
+#include <QPixmap>
+#include <QPointer>
+#include <QSharedDataPointer>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+
+class QFileSystemWatcher;
+class QScreen;
+class QWidget;
+
+enum class ToastPreset {
+    Success,
+    Warning,
+    Error,
+    Information,
+    SuccessDark,
+    WarningDark,
+    ErrorDark,
+    InformationDark
+};
+
+enum class ToastIcon { Success, Warning, Error, Information, Close };
+
+enum class ToastPosition {
+    BottomLeft,
+    BottomMiddle,
+    BottomRight,
+    TopLeft,
+    TopMiddle,
+    TopRight,
+    Center
+};
+
+enum class ToastButtonAlignment { Top, Middle, Bottom };
+
+/**
+ * @brief Toast 的承载方式。
+ */
+enum class ToastHostMode {
+    Window,        ///< 每个 Toast 都是独立的顶层窗口（默认）
+    ScreenOverlay, ///< 每个屏幕一个透明覆盖窗口，承载该屏幕上的所有 Toast
+    Embedded       ///< 作为子控件嵌入到宿主控件中，按宿主控件的几何定位，不创建任何原生窗口
+};
+
+/**
+ * @brief Toast 的样式化方式。
+ */
+enum class ToastStyleMode {
+    StyleSheet, ///< 基础样式表安装在应用级，主题颜色由各子控件的内联样式表设置（默认）
+    Palette     ///< 使用 QPalette 与动态属性，由一份应用级缓存样式表统一匹配，只解析一次
+};
+
+/**
+ * @brief 性能配置，决定每个 Toast 产生的动画、半透明合成与重绘量。
+ */
+enum class ToastPerformanceProfile {
+    Auto,   ///< 根据运行环境选择：远程会话（X11 转发、VNC、RDP）中使用 Minimal，否则使用 Full（默认）
+    Full,   ///< 完整的动画与半透明效果
+    Minimal ///< 立即定位、不透明窗口、预合成阴影与粗粒度进度条，每个 Toast 的像素与请求量最少
+};
+
+/**
+ * @brief 应用恢复可见时，如何处理暂停期间已过期的 Toast：显示中剩余时长不超过暂停时长的 Toast，
+ *        以及等待时间超过自身显示时长的排队 Toast。无限时长的 Toast 永不过期。
+ */
+enum class ToastResumePolicy {
+    Keep,     ///< 全部从暂停处继续（默认）
+    Discard,  ///< 丢弃过期的 Toast
+    Summarize ///< 丢弃过期的 Toast，并以一条汇总 Toast 列出它们的标题
+};
+
+/**
+ * @brief 关闭免打扰模式时，缓存的 Toast 的投递方式。
+ */
+enum class ToastDeliveryMode {
+    Digest, ///< 合并为一条汇总 Toast，列出各条的标题（默认）
+    Replay  ///< 按重放间隔逐条提交，避免一次性涌入
+};
+
+/**
+ * @brief Toast 窗口的渲染方式。
+ */
+enum class ToastRenderMode {
+    Auto,        ///< 没有合成器的平台（linuxfb、eglfs、offscreen 等）或 Minimal 性能配置下使用 Opaque（默认）
+    Translucent, ///< 半透明窗口，圆角与阴影依赖合成器进行 alpha 混合
+    Opaque       ///< 不透明窗口：圆角由窗口遮罩裁剪，阴影预先合成到背景色上，不使用淡入淡出
+};
+
+/**
+ * @brief 事件循环延迟过高时的降级级别，每一级都包含之前各级的措施。
+ */
+enum class ToastDegradation {
+    None,          ///< 不降级（默认）
+    NoDurationBar, ///< 停止持续时间进度条的动画
+    NoFlyIn,       ///< 不再执行飞入与重新排布动画，直接移动到目标位置
+    NoFades,       ///< 不再执行淡入淡出
+    DeferNonErrors ///< 错误以外的 Toast 暂缓显示，直到延迟恢复
+};
+
+/**
+ * @brief 全局单例类，用于管理 Toast 组件的所有全局配置。
+ *
+ */
+class QTTOAST_EXPORT ToastGlobalConfig final
+{
+public:
+    static ToastGlobalConfig &instance() noexcept;
+
+    Q_DISABLE_COPY_MOVE(ToastGlobalConfig)
+
+    // 全局常量 (Colors & Sizes)
+    static const int UpdatePositionDuration;    ///< 位置更新动画时长 (毫秒)
+    static const int DurationBarUpdateInterval; ///< 进度条更新间隔 (毫秒)
+    static const int CoarseDurationBarUpdateInterval; ///< Minimal 性能配置下的进度条更新间隔 (毫秒)
+    static const int DropShadowSize;            ///< 阴影大小 (像素)
+    static const QColor SuccessAccentColor;
+    static const QColor WarningAccentColor;
+    static const QColor ErrorAccentColor;
+    static const QColor InformationAccentColor;
+    static const QColor DefaultAccentColor;
+    static const QColor DefaultBackgroundColor;
+    static const QColor DefaultTitleColor;
+    static const QColor DefaultTextColor;
+    static const QColor DefaultIconSeparatorColor;
+    static const QColor DefaultCloseButtonIconColor;
+    static const QColor DefaultBackgroundColorDark;
+    static const QColor DefaultTitleColorDark;
+    static const QColor DefaultTextColorDark;
+    static const QColor DefaultIconSeparatorColorDark;
+    static const QColor DefaultCloseButtonIconColorDark;
+
+    /**
+     * @brief 获取当前允许同时在屏幕上显示的最大 Toast 数量。
+     * @return 最大显示数量。
+     */
+    [[nodiscard]] int maximumOnScreen() const noexcept;
+
+    /**
+     * @brief 设置允许同时在屏幕上显示的最大 Toast 数量。
+     * @param maximum 指定的最大数量。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setMaximumOnScreen(int maximum) noexcept;
+
+    /**
+     * @brief 获取相邻 Toast 之间的垂直间距（像素）。
+     * @return 间距值。
+     */
+    [[nodiscard]] int spacing() const noexcept;
+
+    /**
+     * @brief 设置相邻 Toast 之间的垂直间距（像素）。
+     * @param spacing 指定的间距值。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setSpacing(int spacing) noexcept;
+
+    /**
+     * @brief 获取 Toast 相对于其锚定边缘的水平偏移量（像素）。
+     * @return 水平偏移量。
+     */
+    [[nodiscard]] int offsetX() const noexcept;
+
+    /**
+     * @brief 获取 Toast 相对于其锚定边缘的垂直偏移量（像素）。
+     * @return 垂直偏移量。
+     */
+    [[nodiscard]] int offsetY() const noexcept;
+
+    /**
+     * @brief 同时设置 Toast 相对于其锚定边缘的水平和垂直偏移量（像素）。
+     * @param x 水平偏移量。
+     * @param y 垂直偏移量。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setOffset(int x, int y) noexcept;
+
+    /**
+     * @brief 设置 Toast 相对于其锚定边缘的水平偏移量（像素）。
+     * @param offsetX 指定的水平偏移量。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setOffsetX(int offsetX) noexcept;
+
+    /**
+     * @brief 设置 Toast 相对于其锚定边缘的垂直偏移量（像素）。
+     * @param offsetY 指定的垂直偏移量。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setOffsetY(int offsetY) noexcept;
+
+    /**
+     * @brief 查询是否强制将所有 Toast 显示在主屏幕上。
+     * @return true 表示强制在主屏幕显示。
+     */
+    [[nodiscard]] bool alwaysOnMainScreen() const noexcept;
+
+    /**
+     * @brief 设置是否强制将所有 Toast 显示在主屏幕上。
+     * @param enabled true 表示启用此功能。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setAlwaysOnMainScreen(bool enabled) noexcept;
+
+    /**
+     * @brief 获取当前被固定作为 Toast 显示目标的特定屏幕。
+     * @return 固定的 QScreen 指针，如果未设置则返回 nullptr。
+     */
+    [[nodiscard]] QScreen *fixedScreen() const noexcept;
+
+    /**
+     * @brief 设置一个固定的屏幕，所有 Toast 将显示在此屏幕上。
+     * @param screen 指向目标 QScreen 的指针。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setFixedScreen(QScreen *screen) noexcept;
+
+    /**
+     * @brief 获取 Toast 在屏幕上的默认显示位置。
+     * @return ToastPosition 枚举值。
+     */
+    [[nodiscard]] ToastPosition position() const noexcept;
+
+    /**
+     * @brief 设置 Toast 在屏幕上的默认显示位置。
+     * @param position ToastPosition 枚举值。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setPosition(ToastPosition position) noexcept;
+
+    /**
+     * @brief 获取 Toast 的承载方式。
+     * @return ToastHostMode 枚举值。
+     */
+    [[nodiscard]] ToastHostMode hostMode() const noexcept;
+
+    /**
+     * @brief 设置 Toast 的承载方式，只影响之后显示的 Toast。
+     *        ScreenOverlay 模式下所有 Toast 作为子控件绘制在每屏一个的覆盖窗口中，
+     *        飞入和重新排列动画不再移动原生窗口。
+     * @param mode ToastHostMode 枚举值。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setHostMode(ToastHostMode mode) noexcept;
+
+    /**
+     * @brief 获取 Embedded 模式下承载 Toast 的宿主控件。定义在 Toast.h 中，属于 QWidget 后端。
+     * @return 宿主控件指针，未设置时返回 nullptr。
+     */
+    [[nodiscard]] QWidget *hostWidget() const noexcept;
+
+    /**
+     * @brief 设置 Embedded 模式下承载 Toast 的宿主控件。未设置时使用各 Toast 自身的父控件。
+     * @param widget 宿主控件。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setHostWidget(QWidget *widget) noexcept;
+
+    /**
+     * @brief 获取 Toast 的样式化方式。
+     * @return ToastStyleMode 枚举值。
+     */
+    [[nodiscard]] ToastStyleMode styleMode() const noexcept;
+
+    /**
+     * @brief 设置 Toast 的样式化方式，只影响之后创建控件的 Toast。
+     *        Palette 模式会向应用程序样式表追加一份 Toast 规则（仅追加一次）。
+     * @param mode ToastStyleMode 枚举值。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setStyleMode(ToastStyleMode mode) noexcept;
+
+    /**
+     * @brief 获取设置的性能配置。
+     * @return ToastPerformanceProfile 枚举值，可能为 Auto。
+     */
+    [[nodiscard]] ToastPerformanceProfile performanceProfile() const noexcept;
+
+    /**
+     * @brief 设置性能配置，只影响之后显示的 Toast。
+     * @param profile ToastPerformanceProfile 枚举值。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setPerformanceProfile(ToastPerformanceProfile profile) noexcept;
+
+    /**
+     * @brief 获取实际生效的性能配置。Auto 时检测一次运行环境并缓存结果：
+     *        环境变量 QTTOAST_PERFORMANCE_PROFILE（full 或 minimal）优先，
+     *        其次是 vnc 平台插件、远程 X11 显示（DISPLAY 含主机名）与 RDP 会话。
+     * @return Full 或 Minimal。
+     */
+    [[nodiscard]] ToastPerformanceProfile effectivePerformanceProfile() const;
+
+    /**
+     * @brief 获取设置的渲染方式。
+     * @return ToastRenderMode 枚举值，可能为 Auto。
+     */
+    [[nodiscard]] ToastRenderMode renderMode() const noexcept;
+
+    /**
+     * @brief 设置顶层窗口模式下 Toast 的渲染方式，只影响之后显示的 Toast。
+     * @param mode ToastRenderMode 枚举值。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setRenderMode(ToastRenderMode mode) noexcept;
+
+    /**
+     * @brief 获取实际生效的渲染方式。
+     * @return Translucent 或 Opaque。
+     */
+    [[nodiscard]] ToastRenderMode effectiveRenderMode() const;
+
+    /**
+     * @brief 获取 Opaque 渲染方式下阴影预合成所用的背景色。
+     * @return 背景色；未设置时无效，此时使用 Toast 调色板的窗口颜色。
+     */
+    [[nodiscard]] const QColor &backdropColor() const noexcept;
+
+    /**
+     * @brief 设置 Opaque 渲染方式下阴影预合成所用的背景色，通常是 Toast 下方桌面或应用界面的主色调。
+     * @param color 背景色，传入无效颜色时恢复默认。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setBackdropColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 获取所有 Toast 共用的基础样式表。首次访问时从 :/css/toast.css 加载一次，之后直接复用。
+     * @return 样式表内容。
+     */
+    [[nodiscard]] const QString &styleSheet() const;
+
+    /**
+     * @brief 在运行时替换基础样式表，并一次性重新应用到所有现存的 Toast。
+     * @param styleSheet 样式表内容；为空时恢复内置的 :/css/toast.css。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setStyleSheet(const QString &styleSheet);
+
+    /**
+     * @brief 从外部文件加载基础样式表，并通过 QFileSystemWatcher 监视该文件，文件变化时自动重新加载。
+     * @param path 样式表文件路径；为空时停止监视并恢复内置样式表。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastGlobalConfig &setStyleSheetFile(const QString &path);
+
+    /**
+     * @brief 获取当前被监视的外部样式表文件路径。
+     * @return 文件路径，未设置时为空。
+     */
+    [[nodiscard]] const QString &styleSheetFile() const noexcept;
+
+private:
+    explicit ToastGlobalConfig() = default;
+    int m_maximumOnScreen{3};
+    int m_spacing{10};
+    int m_offsetX{20};
+    int m_offsetY{45};
+    bool m_alwaysOnMainScreen{false};
+    QScreen *m_fixedScreen{nullptr};
+    ToastPosition m_position{ToastPosition::BottomRight};
+    ToastStyleMode m_styleMode{ToastStyleMode::StyleSheet};
+    ToastHostMode m_hostMode{ToastHostMode::Window};
+    ToastPerformanceProfile m_performanceProfile{ToastPerformanceProfile::Auto};
+    ToastRenderMode m_renderMode{ToastRenderMode::Auto};
+    QColor m_backdropColor;
+    QPointer<QWidget> m_hostWidget;
+    mutable QString m_styleSheet;
+    mutable bool m_styleSheetLoaded{false};
+    QString m_styleSheetFile;
+    QPointer<QFileSystemWatcher> m_styleSheetWatcher;
+    bool m_styleSheetReloadPending{false};
+    std::function<void()> m_styleSheetChanged; ///< 样式表变化时的回调，由 ToastManager 设置
+
+    friend class ToastManager;
+
+    void reloadStyleSheetFile();
+};
+
+class ToastTheme;
+struct ToastConfigData;
+struct ToastThemeData;
+
+/**
+ * @brief 配置类，用于定义单个 Toast 实例的外观和行为。
+ *
+ * 采用隐式共享（写时复制）：复制只增加一次引用计数；外观部分默认引用共享且不可变的
+ * 预设样式，只有被修改时才会分离出当前配置自己的副本。
+ */
+class QTTOAST_EXPORT ToastConfig final
+{
+public:
+    ToastConfig();
+    ToastConfig(const ToastConfig &other);
+    ToastConfig(ToastConfig &&other) noexcept;
+    ToastConfig &operator=(const ToastConfig &other);
+    ToastConfig &operator=(ToastConfig &&other) noexcept;
+    ~ToastConfig();
+
+    /**
+     * @brief 根据枚举值获取对应的图标 QPixmap。
+     * @param enumIcon ToastIcon 枚举值。
+     * @return 对应图标的 QPixmap。
+     */
+    static QPixmap getIconFromEnum(ToastIcon enumIcon) noexcept;
+
+    /**
+     * @brief 将给定的 QImage 的颜色重新着色为指定的颜色，同时保留原始透明度。
+     * @param image 需要重新着色的 QImage。
+     * @param color 新的颜色。
+     * @return 重新着色后的 QImage。
+     */
+    static QImage recolorImage(QImage image, const QColor &color) noexcept;
+
+    /**
+     * @brief 应用预设样式到此配置。
+     * @param preset 要应用的预设（例如，Success, Warning）。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setPreset(ToastPreset preset) noexcept;
+
+    /**
+     * @brief 使用已注册的主题作为外观。之后若修改任何外观项，则该配置不再引用主题的预计算结果。
+     * @param theme 主题句柄，为空时忽略。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTheme(const ToastTheme &theme) noexcept;
+
+    /**
+     * @brief 按名称使用已注册的主题作为外观。
+     * @param name 主题名称，未注册时忽略。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTheme(const QString &name) noexcept;
+
+    /**
+     * @brief 获取当前外观对应的主题。
+     * @return 主题句柄；如果未使用主题或外观已被修改则返回空句柄。
+     */
+    [[nodiscard]] ToastTheme theme() const noexcept;
+
+    /**
+     * @brief 设置 Toast 的显示持续时间。
+     * @param duration 持续时间，单位为毫秒；0 表示无限持续时间。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setDuration(int duration) noexcept;
+
+    /**
+     * @brief 设置在等待队列中的存活时间。排到显示时已超过该时间的 Toast 会被直接丢弃，不再显示。
+     * @param timeToLive 存活时间，单位为毫秒，从提交时开始计算；0 表示不限。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setQueueTimeToLive(int timeToLive) noexcept;
+
+    /**
+     * @brief 设置绝对过期时刻。排到显示时已过该时刻的 Toast 会被直接丢弃，不再显示。
+     * @param expiresAt 过期时刻；无效的时刻表示不过期。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setExpiresAt(const QDateTime &expiresAt) noexcept;
+
+    /**
+     * @brief 启用或禁用持续时间进度条的显示。
+     * @param enabled true 表示显示进度条。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setShowDurationBar(bool enabled) noexcept;
+
+    /**
+     * @brief 设置标题文本。
+     * @param title 标题字符串。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTitle(const QString &title) noexcept;
+
+    /**
+     * @brief 设置主要内容文本。
+     * @param text 要显示的文本。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setText(const QString &text) noexcept;
+
+    /**
+     * @brief 设置 Toast::appendLine() 保留的最大行数，超出时丢弃最早的行。
+     * @param limit 行数，至少为 1。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setLogLineLimit(int limit) noexcept;
+
+    /**
+     * @brief 设置标题与正文参与测量和显示的最大字符数。超出部分在测量前截去并以省略号结尾，
+     *        点击 Toast 的文本可以在单独的窗口中查看全文，使单个 Toast 的布局耗时有确定的上限。
+     * @param limit 字符数；0 表示不限。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTextCharacterLimit(int limit) noexcept;
+
+    /**
+     * @brief 设置标题与正文参与测量和显示的最大行数（按换行符计），超出的行与字符数限制一样处理。
+     * @param limit 行数；0 表示不限。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTextLineLimit(int limit) noexcept;
+
+    /**
+     * @brief 截断文本，最多保留 characterLimit 个字符与 lineLimit 行（按换行符计）。
+     *        只扫描保留的部分，耗时取决于限制而与文本总长度无关。
+     * @param text 原文。
+     * @param characterLimit 最大字符数；0 表示不限。
+     * @param lineLimit 最大行数；0 表示不限。
+     * @param elided 可选，发生截断时置为 true，否则置为 false。
+     * @return 截断后的文本，发生截断时以省略号结尾。
+     */
+    [[nodiscard]] static QString elidedText(
+        const QString &text, int characterLimit, int lineLimit, bool *elided = nullptr);
+
+    /**
+     * @brief 设置自定义图标 pixmap。
+     * @param icon 用作图标的 pixmap。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIcon(const QPixmap &icon) noexcept;
+
+    /**
+     * @brief 使用内置枚举设置图标。
+     * @param icon 图标类型（Success, Warning 等）。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIcon(ToastIcon icon) noexcept;
+
+    /**
+     * @brief 显示或隐藏图标区域。
+     * @param enabled true 表示显示图标。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setShowIcon(bool enabled) noexcept;
+
+    /**
+     * @brief 设置图标的尺寸。
+     * @param size 期望的尺寸。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIconSize(const QSize &size) noexcept;
+
+    /**
+     * @brief 显示或隐藏图标与文本之间的垂直分隔线。
+     * @param enabled true 表示显示分隔线。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setShowIconSeparator(bool enabled) noexcept;
+
+    /**
+     * @brief 设置图标分隔线的宽度。
+     * @param width 宽度，单位为像素。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIconSeparatorWidth(int width) noexcept;
+
+    /**
+     * @brief 设置自定义关闭按钮图标。
+     * @param icon 关闭按钮的 pixmap。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonIcon(const QPixmap &icon) noexcept;
+
+    /**
+     * @brief 使用内置枚举设置关闭按钮图标。
+     * @param icon 应为 Close 图标。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonIcon(ToastIcon icon) noexcept;
+
+    /**
+     * @brief 显示或隐藏关闭按钮。
+     * @param enabled true 表示显示按钮。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setShowCloseButton(bool enabled) noexcept;
+
+    /**
+     * @brief 设置关闭按钮图标的尺寸。
+     * @param size 图标尺寸。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonIconSize(const QSize &size) noexcept;
+
+    /**
+     * @brief 设置关闭按钮区域的总尺寸。
+     * @param size 区域尺寸。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonSize(const QSize &size) noexcept;
+
+    /**
+     * @brief 设置关闭按钮在其区域内对齐方式。
+     * @param alignment Top, Middle 或 Bottom。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonAlignment(ToastButtonAlignment alignment) noexcept;
+
+    /**
+     * @brief 设置淡入动画的持续时间。
+     * @param duration 持续时间，单位为毫秒。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setFadeInDuration(int duration) noexcept;
+
+    /**
+     * @brief 设置淡出动画的持续时间。
+     * @param duration 持续时间，单位为毫秒。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setFadeOutDuration(int duration) noexcept;
+
+    /**
+     * @brief 当鼠标悬停在 Toast 上时重置其持续时间计时器。
+     * @param enabled true 表示启用悬停时重置功能。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setResetDurationOnHover(bool enabled) noexcept;
+
+    /**
+     * @brief 使 Toast 保持在其他窗口之上。
+     * @param enabled true 表示启用置顶行为。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setStayOnTop(bool enabled) noexcept;
+
+    /**
+     * @brief 设置圆角矩形的圆角半径。
+     * @param borderRadius 半径，单位为像素。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setBorderRadius(int borderRadius) noexcept;
+
+    /**
+     * @brief 设置 Toast 的背景颜色。
+     * @param color 背景颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setBackgroundColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置标题文本的颜色。
+     * @param color 标题文本颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTitleColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置正文文本的颜色。
+     * @param color 正文文本颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTextColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置应用于图标的色调颜色。
+     * @param color 图标色调颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIconColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置图标分隔线的颜色。
+     * @param color 分隔线颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIconSeparatorColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置关闭按钮图标的颜色。
+     * @param color 关闭图标颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonIconColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置持续时间进度条的颜色。
+     * @param color 进度条颜色。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setDurationBarColor(const QColor &color) noexcept;
+
+    /**
+     * @brief 设置标题的字体。
+     * @param font 标题字体。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTitleFont(const QFont &font) noexcept;
+
+    /**
+     * @brief 设置正文文本的字体。
+     * @param font 正文文本字体。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTextFont(const QFont &font) noexcept;
+
+    /**
+     * @brief 设置围绕整个 Toast 的外边距。
+     * @param margins 边距（左、上、右、下）。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setMargins(const QMargins &margins) noexcept;
+
+    /**
+     * @brief 设置围绕图标的边距。
+     * @param margins 图标专用边距。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIconMargins(const QMargins &margins) noexcept;
+
+    /**
+     * @brief 设置围绕图标区域（容器）的边距。
+     * @param margins 容器边距。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setIconSectionMargins(const QMargins &margins) noexcept;
+
+    /**
+     * @brief 设置围绕文本区域（容器）的边距。
+     * @param margins 容器边距。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTextSectionMargins(const QMargins &margins) noexcept;
+
+    /**
+     * @brief 设置围绕关闭按钮的边距。
+     * @param margins 按钮边距。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setCloseButtonMargins(const QMargins &margins) noexcept;
+
+    /**
+     * @brief 设置图标区域和文本区域之间的间距。
+     * @param spacing 间距，单位为像素。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastConfig &setTextSectionSpacing(int spacing) noexcept;
+
+    [[nodiscard]] int duration() const noexcept;
+    [[nodiscard]] int queueTimeToLive() const noexcept;
+    [[nodiscard]] const QDateTime &expiresAt() const noexcept;
+
+    /**
+     * @brief 判断排队中的 Toast 是否已超过队列存活时间或绝对过期时刻。
+     * @param queuedFor 已在队列中等待的时长（微秒）。
+     * @return 应当丢弃而不再显示时返回 true。
+     */
+    [[nodiscard]] bool isExpired(qint64 queuedFor) const;
+
+    [[nodiscard]] bool showDurationBar() const noexcept;
+    [[nodiscard]] const QString &text() const noexcept;
+    [[nodiscard]] int logLineLimit() const noexcept;
+    [[nodiscard]] int textCharacterLimit() const noexcept;
+    [[nodiscard]] int textLineLimit() const noexcept;
+    [[nodiscard]] const QString &title() const noexcept;
+    [[nodiscard]] QPixmap icon() const noexcept;
+    [[nodiscard]] ToastIcon iconType() const noexcept;
+    [[nodiscard]] bool showIcon() const noexcept;
+    [[nodiscard]] const QSize &iconSize() const noexcept;
+    [[nodiscard]] bool showIconSeparator() const noexcept;
+    [[nodiscard]] int iconSeparatorWidth() const noexcept;
+    [[nodiscard]] QPixmap closeButtonIcon() const noexcept;
+    [[nodiscard]] bool showCloseButton() const noexcept;
+    [[nodiscard]] const QSize &closeButtonIconSize() const noexcept;
+    [[nodiscard]] const QSize &closeButtonSize() const noexcept;
+    [[nodiscard]] ToastButtonAlignment closeButtonAlignment() const noexcept;
+    [[nodiscard]] int fadeInDuration() const noexcept;
+    [[nodiscard]] int fadeOutDuration() const noexcept;
+    [[nodiscard]] bool resetDurationOnHover() const noexcept;
+    [[nodiscard]] bool stayOnTop() const noexcept;
+    [[nodiscard]] int borderRadius() const noexcept;
+    [[nodiscard]] const QColor &backgroundColor() const noexcept;
+    [[nodiscard]] const QColor &titleColor() const noexcept;
+    [[nodiscard]] const QColor &textColor() const noexcept;
+    [[nodiscard]] const QColor &iconColor() const noexcept;
+    [[nodiscard]] const QColor &iconSeparatorColor() const noexcept;
+    [[nodiscard]] const QColor &closeButtonIconColor() const noexcept;
+    [[nodiscard]] const QColor &durationBarColor() const noexcept;
+    [[nodiscard]] const QFont &titleFont() const noexcept;
+    [[nodiscard]] const QFont &textFont() const noexcept;
+    [[nodiscard]] const QMargins &margins() const noexcept;
+    [[nodiscard]] const QMargins &iconMargins() const noexcept;
+    [[nodiscard]] const QMargins &iconSectionMargins() const noexcept;
+    [[nodiscard]] const QMargins &textSectionMargins() const noexcept;
+    [[nodiscard]] const QMargins &closeButtonMargins() const noexcept;
+    [[nodiscard]] int textSectionSpacing() const noexcept;
+
+private:
+    friend class ToastTheme;
+    friend class ToastThemeRegistry;
+
+    QSharedDataPointer<ToastConfigData> d;
+};
+
+/**
+ * @brief 主题句柄。主题在注册时一次性计算好调色板、样式表、着色后的图标和派生颜色，
+ *        引用该主题的 Toast 不再需要任何样式计算。复制代价为一次引用计数。
+ *
+ */
+class QTTOAST_EXPORT ToastTheme final
+{
+public:
+    ToastTheme() = default;
+
+    /**
+     * @brief 根据配置的当前外观计算一个未注册的临时主题。
+     * @param config 外观来源。
+     * @return 临时主题。
+     */
+    [[nodiscard]] static ToastTheme fromConfig(const ToastConfig &config);
+
+    [[nodiscard]] bool isNull() const noexcept;
+    [[nodiscard]] const QString &name() const noexcept;
+    [[nodiscard]] const QPalette &palette() const noexcept;
+    [[nodiscard]] const QIcon &icon() const noexcept;
+    [[nodiscard]] const QIcon &closeButtonIcon() const noexcept;
+    [[nodiscard]] const QColor &buttonColor() const noexcept;
+    [[nodiscard]] const QColor &buttonBorderColor() const noexcept;
+    [[nodiscard]] const QColor &buttonHoverColor() const noexcept;
+    [[nodiscard]] const QColor &buttonPressedColor() const noexcept;
+
+    [[nodiscard]] bool operator==(const ToastTheme &other) const noexcept;
+    [[nodiscard]] bool operator!=(const ToastTheme &other) const noexcept;
+
+private:
+    friend class Toast;
+    friend class ToastConfig;
+    friend class ToastThemeRegistry;
+
+    explicit ToastTheme(std::shared_ptr<const ToastThemeData> data) noexcept;
+
+    std::shared_ptr<const ToastThemeData> d;
+};
+
+/**
+ * @brief 全局单例类，按名称管理已注册的 Toast 主题。内置的 8 个预设同样以主题形式注册。
+ *
+ */
+class QTTOAST_EXPORT ToastThemeRegistry final
+{
+public:
+    static ToastThemeRegistry &instance() noexcept;
+
+    Q_DISABLE_COPY_MOVE(ToastThemeRegistry)
+
+    /**
+     * @brief 注册（或替换）一个主题，并立即计算其全部样式产物。
+     * @param name 主题名称。
+     * @param appearance 外观来源，仅使用其中的外观项。
+     * @return 新主题的句柄。
+     */
+    ToastTheme registerTheme(const QString &name, const ToastConfig &appearance);
+
+    /**
+     * @brief 注销一个主题。已引用该主题的配置不受影响。
+     * @param name 主题名称。
+     * @return 如果主题存在并被移除则返回 true。
+     */
+    bool unregisterTheme(const QString &name) noexcept;
+
+    /**
+     * @brief 按名称查找主题。
+     * @param name 主题名称。
+     * @return 主题句柄，未找到时为空。
+     */
+    [[nodiscard]] ToastTheme theme(const QString &name) const noexcept;
+
+    /**
+     * @brief 获取内置预设对应的主题。
+     * @param preset 预设。
+     * @return 主题句柄。
+     */
+    [[nodiscard]] ToastTheme preset(ToastPreset preset) const noexcept;
+
+    /**
+     * @brief 获取未应用任何预设时的默认主题。
+     * @return 主题句柄。
+     */
+    [[nodiscard]] ToastTheme defaultTheme() const noexcept;
+
+    /**
+     * @brief 查询主题是否为默认主题或内置预设之一。
+     * @param theme 主题句柄。
+     * @return 是内置主题时返回 true。
+     */
+    [[nodiscard]] bool isBuiltIn(const ToastTheme &theme) const noexcept;
+
+    /**
+     * @brief 获取所有已注册主题的名称。
+     * @return 名称列表。
+     */
+    [[nodiscard]] QStringList names() const;
+
+private:
+    explicit ToastThemeRegistry();
+    QHash<QString, ToastTheme> m_themes;
+    std::array<ToastTheme, 8> m_presets;
+    ToastTheme m_default;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "ToastConfig.h"
+#include <QSharedData>
+
+/**
+ * @brief 注册库内置的资源（图标与基础样式表）。静态链接时资源不会自动注册，首次使用前调用一次即可。
+ */
+void qtToastInitResources();
+
+/**
+ * @brief Toast 外观数据。预设以共享且不可变的实例提供，修改时写时复制。
+ */
+struct ToastStyleData : public QSharedData
+{
+    bool showDurationBar{true};
+    ToastIcon icon{ToastIcon::Information};
+    QPixmap customIcon; ///< 自定义图标，为空时使用 icon 枚举对应的内置图标
+    bool showIcon{false};
+    QSize iconSize{18, 18};
+    bool showIconSeparator{true};
+    int iconSeparatorWidth{2};
+    ToastIcon closeButtonIcon{ToastIcon::Close};
+    QPixmap customCloseButtonIcon; ///< 自定义关闭图标，为空时使用 closeButtonIcon 枚举
+    bool showCloseButton{true};
+    QSize closeButtonIconSize{10, 10};
+    QSize closeButtonSize{24, 24};
+    ToastButtonAlignment closeButtonAlignment{ToastButtonAlignment::Middle};
+    int fadeInDuration{250};
+    int fadeOutDuration{250};
+    int borderRadius{4};
+    QColor backgroundColor{ToastGlobalConfig::DefaultBackgroundColor};
+    QColor titleColor{ToastGlobalConfig::DefaultTitleColor};
+    QColor textColor{ToastGlobalConfig::DefaultTextColor};
+    QColor iconColor{ToastGlobalConfig::DefaultAccentColor};
+    QColor iconSeparatorColor{ToastGlobalConfig::DefaultIconSeparatorColor};
+    QColor closeButtonIconColor{ToastGlobalConfig::DefaultCloseButtonIconColor};
+    QColor durationBarColor{ToastGlobalConfig::DefaultAccentColor};
+    QFont titleFont{"Arial", 10, QFont::Bold};
+    QFont textFont{"Arial", 9};
+    QMargins margins{20, 18, 10, 18};
+    QMargins iconMargins{0, 0, 15, 0};
+    QMargins iconSectionMargins{0, 0, 15, 0};
+    QMargins textSectionMargins{0, 0, 15, 0};
+    QMargins closeButtonMargins{0, -8, 0, -8};
+    int textSectionSpacing{8};
+};
+
+/**
+ * @brief 单个 Toast 的内容与行为数据，外观部分引用共享的 ToastStyleData。
+ */
+struct ToastConfigData : public QSharedData
+{
+    int duration{5000};
+    int queueTimeToLive{0}; ///< 队列存活时间（毫秒），0 表示不限
+    QDateTime expiresAt;    ///< 绝对过期时刻，无效表示不过期
+    QString title;
+    QString text;
+    int logLineLimit{8};          ///< appendLine() 保留的最大行数
+    int textCharacterLimit{2000}; ///< 标题与正文参与测量的最大字符数，0 表示不限
+    int textLineLimit{20};        ///< 标题与正文参与测量的最大行数，0 表示不限
+    bool resetDurationOnHover{true};
+    bool stayOnTop{true};
+    QSharedDataPointer<ToastStyleData> style;
+    ToastTheme theme; ///< 外观来源主题，仅当 style 仍与主题共享时有效
+};
+
+/**
+ * @brief 主题数据：共享的外观基础以及注册时一次性计算好的全部样式产物。
+ */
+struct ToastThemeData
+{
+    QString name;
+    QSharedDataPointer<ToastStyleData> style;
+    QPalette palette;
+    QIcon icon;
+    QIcon closeButtonIcon;
+    QColor buttonColor;
+    QColor buttonBorderColor;
+    QColor buttonHoverColor;
+    QColor buttonPressedColor;
+    QString notificationStyleSheet;
+    QString durationBarStyleSheet;
+    QString durationBarChunkStyleSheet;         ///< 有限持续时间
+    QString durationBarChunkStyleSheetInfinite; ///< 无限持续时间（duration == 0）
+    QString iconSeparatorStyleSheet;
+    QString titleStyleSheet;
+    QString textStyleSheet;
+    QString buttonStyleSheet;
+    // Palette 模式下各部件使用的调色板
+    QPalette notificationPalette;
+    QPalette durationBarPalette;
+    QPalette durationBarChunkPalette;
+    QPalette iconSeparatorPalette;
+    QPalette titlePalette;
+    QPalette textPalette;
+    QPalette buttonPalette;
+};
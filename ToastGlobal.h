@@ -0,0 +1,21 @@
+#pragma once
+
+#include <QtGlobal>
+
+// 构建 qttoast 库时定义 QTTOAST_LIBRARY；静态库的构建方与使用方都定义 QTTOAST_STATIC
+#if defined(QTTOAST_STATIC)
+#define QTTOAST_EXPORT
+#elif defined(QTTOAST_LIBRARY)
+#define QTTOAST_EXPORT Q_DECL_EXPORT
+#else
+#define QTTOAST_EXPORT Q_DECL_IMPORT
+#endif
+
+// 构建 qttoast_widgets 库时定义 QTTOAST_WIDGETS_LIBRARY
+#if defined(QTTOAST_STATIC)
+#define QTTOAST_WIDGETS_EXPORT
+#elif defined(QTTOAST_WIDGETS_LIBRARY)
+#define QTTOAST_WIDGETS_EXPORT Q_DECL_EXPORT
+#else
+#define QTTOAST_WIDGETS_EXPORT Q_DECL_IMPORT
+#endif
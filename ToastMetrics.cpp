@@ -0,0 +1,232 @@
+#include "ToastMetrics.h"
+#include <algorithm>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QVariantAnimation>
+#include <QtAlgorithms>
+
+namespace {
+/// QUnifiedTimer 驱动 QPropertyAnimation 的固定间隔（微秒），与屏幕刷新率无关
+constexpr qint64 AnimationTimerInterval = 16 * 1000;
+} // namespace
+
+void ToastHistogram::record(qint64 microseconds) noexcept
+{
+    const qint64 value = std::max<qint64>(0, microseconds);
+    const int width = 64 - static_cast<int>(qCountLeadingZeroBits(static_cast<quint64>(value)));
+    m_buckets[static_cast<size_t>(std::min(width, BucketCount - 1))]++;
+    m_min = m_count == 0 ? value : std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    m_sum += value;
+    m_count++;
+}
+
+void ToastHistogram::reset() noexcept
+{
+    *this = ToastHistogram();
+}
+
+quint64 ToastHistogram::count() const noexcept
+{
+    return m_count;
+}
+
+qint64 ToastHistogram::sum() const noexcept
+{
+    return m_sum;
+}
+
+qint64 ToastHistogram::min() const noexcept
+{
+    return m_min;
+}
+
+qint64 ToastHistogram::max() const noexcept
+{
+    return m_max;
+}
+
+qint64 ToastHistogram::mean() const noexcept
+{
+    return m_count == 0 ? 0 : m_sum / static_cast<qint64>(m_count);
+}
+
+qint64 ToastHistogram::percentile(double quantile) const noexcept
+{
+    if (m_count == 0) {
+        return 0;
+    }
+    const double clamped = std::clamp(quantile, 0.0, 1.0);
+    const double target = clamped * static_cast<double>(m_count);
+    const auto rank = std::max<quint64>(1, static_cast<quint64>(target + 0.5));
+    quint64 seen = 0;
+    for (int i = 0; i < BucketCount; i++) {
+        seen += m_buckets[static_cast<size_t>(i)];
+        if (seen >= rank) {
+            return std::clamp(bucketUpperBound(i), m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+const std::array<quint64, ToastHistogram::BucketCount> &ToastHistogram::buckets() const noexcept
+{
+    return m_buckets;
+}
+
+qint64 ToastHistogram::bucketUpperBound(int index) noexcept
+{
+    return qint64(1) << std::clamp(index, 0, BucketCount - 1);
+}
+
+ToastMetrics::ToastMetrics(QObject *parent)
+    : QObject(parent)
+{
+    qRegisterMetaType<ToastMetricsSnapshot>();
+}
+
+qint64 ToastMetrics::now() noexcept
+{
+    static const QElapsedTimer s_clock = []() {
+        QElapsedTimer clock;
+        clock.start();
+        return clock;
+    }();
+    return s_clock.nsecsElapsed() / 1000;
+}
+
+const ToastMetricsSnapshot &ToastMetrics::snapshot() const noexcept
+{
+    return m_snapshot;
+}
+
+void ToastMetrics::reset() noexcept
+{
+    m_snapshot = ToastMetricsSnapshot();
+}
+
+int ToastMetrics::reportInterval() const noexcept
+{
+    return m_reportTimer != nullptr && m_reportTimer->isActive() ? m_reportTimer->interval() : 0;
+}
+
+ToastMetrics &ToastMetrics::setReportInterval(int interval)
+{
+    if (interval <= 0) {
+        if (m_reportTimer != nullptr) {
+            m_reportTimer->stop();
+        }
+        return *this;
+    }
+    if (m_reportTimer == nullptr) {
+        // 只有需要周期上报时才创建定时器
+        m_reportTimer = new QTimer(this);
+        connect(m_reportTimer, &QTimer::timeout, this, [this]() { emit reported(m_snapshot); });
+    }
+    m_reportTimer->start(interval);
+    return *this;
+}
+
+bool ToastMetrics::isFrameMonitorEnabled() const noexcept
+{
+    return m_frameMonitorEnabled;
+}
+
+ToastMetrics &ToastMetrics::setFrameMonitorEnabled(bool enabled) noexcept
+{
+    m_frameMonitorEnabled = enabled;
+    return *this;
+}
+
+void ToastMetrics::monitorAnimation(
+    QVariantAnimation *animation, ToastAnimationKind kind, qreal refreshRate)
+{
+    if (!m_frameMonitorEnabled || animation == nullptr) {
+        return;
+    }
+    const auto refreshPeriod =
+        static_cast<qint64>(1000000.0 / (refreshRate > 0 ? refreshRate : 60));
+    // 动画按固定间隔推进而不是按垂直同步，高刷新率屏幕上一帧不会短于该间隔
+    const qint64 framePeriod = std::max(refreshPeriod, AnimationTimerInterval);
+    // 启动时的第一次 valueChanged 只作为起点，之后每次回调对应动画驱动的一帧
+    qint64 previous = 0;
+    auto onFrame = [this, kind, framePeriod, previous]() mutable {
+        const qint64 current = now();
+        if (previous != 0) {
+            recordFrame(kind, current - previous, framePeriod);
+        }
+        previous = current;
+    };
+    connect(animation, &QVariantAnimation::valueChanged, this, onFrame);
+}
+
+void ToastMetrics::recordPresented() noexcept
+{
+    m_snapshot.presented++;
+}
+
+void ToastMetrics::recordShown(qint64 queueWait, qint64 presentToVisible) noexcept
+{
+    m_snapshot.shown++;
+    m_snapshot.queueWait.record(queueWait);
+    m_snapshot.presentToVisible.record(presentToVisible);
+}
+
+void ToastMetrics::recordDropped(quint64 count) noexcept
+{
+    m_snapshot.dropped += count;
+}
+
+void ToastMetrics::recordCancelled(quint64 count) noexcept
+{
+    m_snapshot.cancelled += count;
+}
+
+void ToastMetrics::recordExpired(quint64 count) noexcept
+{
+    m_snapshot.expired += count;
+}
+
+void ToastMetrics::recordCoalesced(quint64 count) noexcept
+{
+    m_snapshot.coalesced += count;
+}
+
+void ToastMetrics::recordRateLimited(quint64 count) noexcept
+{
+    m_snapshot.rateLimited += count;
+}
+
+void ToastMetrics::recordLifetime(qint64 lifetime) noexcept
+{
+    m_snapshot.lifetime.record(lifetime);
+}
+
+void ToastMetrics::recordConstruction(qint64 duration) noexcept
+{
+    m_snapshot.construction.record(duration);
+}
+
+void ToastMetrics::recordFrame(
+    ToastAnimationKind kind, qint64 frameTime, qint64 framePeriod) noexcept
+{
+    auto &histogram = kind == ToastAnimationKind::Reflow ? m_snapshot.reflowFrameTime
+                                                         : m_snapshot.toastFrameTime;
+    histogram.record(frameTime);
+    m_snapshot.frames++;
+    // 帧间隔超过一个半刷新周期时，多出的整周期数即为错过的帧
+    if (framePeriod > 0 && frameTime * 2 > framePeriod * 3) {
+        const qint64 periods = (frameTime + framePeriod / 2) / framePeriod;
+        m_snapshot.droppedFrames += static_cast<quint64>(periods - 1);
+    }
+}
+
+void ToastMetrics::recordEventLoopLag(qint64 lag) noexcept
+{
+    m_snapshot.eventLoopLag.record(lag);
+}
+
+void ToastMetrics::recordDegradation(int level) noexcept
+{
+    m_snapshot.degradation = level;
+}
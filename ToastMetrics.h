@@ -0,0 +1,189 @@
+#pragma once
+
+#include "ToastGlobal.h"
+#include <array>
+#include <QMetaType>
+#include <QObject>
+
+class QTimer;
+class QVariantAnimation;
+
+/**
+ * @brief 帧时间监视的动画类别。
+ */
+enum class ToastAnimationKind {
+    Toast, ///< 单个 Toast 的淡入、淡出与飞入
+    Reflow ///< 堆叠偏移变化后的重新排布
+};
+
+/**
+ * @brief 固定内存的对数直方图：第 i 个桶统计 [2^(i-1), 2^i) 微秒内的样本（第 0 个桶只统计 0）。
+ *        记录一个样本只需要一次位运算和一次自增，适合在 GUI 线程中常开。
+ *
+ */
+class QTTOAST_EXPORT ToastHistogram final
+{
+public:
+    static constexpr int BucketCount = 32; ///< 最后一个桶收纳约 18 分钟以上的样本
+
+    /**
+     * @brief 记录一个样本。
+     * @param microseconds 样本值（微秒），小于 0 时按 0 处理。
+     */
+    void record(qint64 microseconds) noexcept;
+
+    /**
+     * @brief 清空所有样本。
+     */
+    void reset() noexcept;
+
+    [[nodiscard]] quint64 count() const noexcept;
+    [[nodiscard]] qint64 sum() const noexcept;
+    [[nodiscard]] qint64 min() const noexcept;
+    [[nodiscard]] qint64 max() const noexcept;
+    [[nodiscard]] qint64 mean() const noexcept;
+
+    /**
+     * @brief 估算分位数：返回该分位所在桶的上界，并不超过最大样本值。
+     * @param quantile 分位，范围 [0, 1]，例如 0.95。
+     * @return 分位数估计值（微秒）；没有样本时返回 0。
+     */
+    [[nodiscard]] qint64 percentile(double quantile) const noexcept;
+
+    /**
+     * @brief 获取各桶的样本数量。
+     * @return 桶数组的常量引用。
+     */
+    [[nodiscard]] const std::array<quint64, BucketCount> &buckets() const noexcept;
+
+    /**
+     * @brief 获取第 index 个桶的上界（不含）。
+     * @param index 桶索引。
+     * @return 上界（微秒）。
+     */
+    [[nodiscard]] static qint64 bucketUpperBound(int index) noexcept;
+
+private:
+    std::array<quint64, BucketCount> m_buckets{};
+    quint64 m_count{0};
+    qint64 m_sum{0};
+    qint64 m_min{0};
+    qint64 m_max{0};
+};
+
+/**
+ * @brief ToastManager 运行指标的快照。计数器自启动或上次 reset() 起累计，时间单位均为微秒。
+ */
+struct ToastMetricsSnapshot
+{
+    quint64 presented{0};     ///< 提交给管理器的 Toast 数量
+    quint64 shown{0};         ///< 实际显示的 Toast 数量
+    quint64 dropped{0};       ///< 显示前被移出队列的 Toast 数量
+    quint64 cancelled{0};     ///< 显示前通过 ToastHandle::close() 取消的数量
+    quint64 expired{0};       ///< 排到显示时已超过存活时间而被丢弃的数量
+    quint64 coalesced{0};     ///< 被合并进其他 Toast 而未单独显示的数量
+    quint64 rateLimited{0};   ///< 因限流而延后或舍弃的数量
+    quint64 frames{0};        ///< 帧监视开启后记录的动画帧数
+    quint64 droppedFrames{0}; ///< 按屏幕刷新率计算错过的帧数
+    int degradation{0};       ///< 当前降级级别（ToastDegradation 的数值）
+
+    ToastHistogram queueWait;        ///< 从提交到离开队列的等待时间
+    ToastHistogram presentToVisible; ///< 从提交到控件显示完成的延迟
+    ToastHistogram lifetime;         ///< 从显示到结束（淡出完成）的时间
+    ToastHistogram construction;     ///< 创建控件并完成首次显示布局的耗时
+    ToastHistogram toastFrameTime;   ///< 淡入、淡出与飞入动画的帧间隔
+    ToastHistogram reflowFrameTime;  ///< 重新排布动画的帧间隔
+    ToastHistogram eventLoopLag;     ///< 自适应降级开启后采样的事件循环延迟
+};
+
+Q_DECLARE_METATYPE(ToastMetricsSnapshot)
+
+/**
+ * @brief 运行指标记录器，由 ToastManager 持有。可以随时读取快照，也可以设置上报间隔，
+ *        由 reported 信号周期性地发出快照，便于在 Toast 风暴影响响应速度时报警。
+ *
+ */
+class QTTOAST_EXPORT ToastMetrics final : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ToastMetrics(QObject *parent = nullptr);
+
+    /**
+     * @brief 获取单调时钟的当前时间，所有记录的时间戳都应来自该时钟。
+     * @return 时间戳（微秒）。
+     */
+    [[nodiscard]] static qint64 now() noexcept;
+
+    /**
+     * @brief 获取当前快照。
+     * @return 快照的常量引用。
+     */
+    [[nodiscard]] const ToastMetricsSnapshot &snapshot() const noexcept;
+
+    /**
+     * @brief 清零所有计数器与直方图。
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief 获取上报间隔。
+     * @return 间隔（毫秒），0 表示不周期上报。
+     */
+    [[nodiscard]] int reportInterval() const noexcept;
+
+    /**
+     * @brief 设置上报间隔，每隔该时间发出一次 reported 信号。
+     * @param interval 间隔（毫秒），0 表示停止上报。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastMetrics &setReportInterval(int interval);
+
+    /**
+     * @brief 查询是否监视动画帧时间。
+     * @return 开启时返回 true。
+     */
+    [[nodiscard]] bool isFrameMonitorEnabled() const noexcept;
+
+    /**
+     * @brief 开启或关闭动画帧时间监视。默认关闭，关闭时动画不会连接任何额外的槽。
+     * @param enabled 是否监视。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastMetrics &setFrameMonitorEnabled(bool enabled) noexcept;
+
+    /**
+     * @brief 监视一个即将启动的动画：记录相邻两帧之间的间隔，并统计错过的帧。
+     *        帧周期取刷新周期与动画定时器间隔（16 毫秒）中的较大者。帧监视关闭时不做任何事。
+     * @param animation 动画。
+     * @param kind 动画类别。
+     * @param refreshRate 所在屏幕的刷新率（Hz），不大于 0 时按 60 Hz 计算。
+     */
+    void monitorAnimation(QVariantAnimation *animation, ToastAnimationKind kind, qreal refreshRate);
+
+    void recordPresented() noexcept;
+    void recordShown(qint64 queueWait, qint64 presentToVisible) noexcept;
+    void recordDropped(quint64 count = 1) noexcept;
+    void recordCancelled(quint64 count = 1) noexcept;
+    void recordExpired(quint64 count = 1) noexcept;
+    void recordCoalesced(quint64 count = 1) noexcept;
+    void recordRateLimited(quint64 count = 1) noexcept;
+    void recordLifetime(qint64 lifetime) noexcept;
+    void recordConstruction(qint64 duration) noexcept;
+    void recordFrame(ToastAnimationKind kind, qint64 frameTime, qint64 framePeriod) noexcept;
+    void recordEventLoopLag(qint64 lag) noexcept;
+    void recordDegradation(int level) noexcept;
+
+signals:
+    /**
+     * @brief 按上报间隔周期性发出的快照。
+     * @param snapshot 当前快照。
+     */
+    void reported(const ToastMetricsSnapshot &snapshot);
+
+private:
+    ToastMetricsSnapshot m_snapshot;
+    QTimer *m_reportTimer{nullptr};
+    bool m_frameMonitorEnabled{false};
+};
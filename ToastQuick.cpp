@@ -0,0 +1,706 @@
+#include "ToastQuick.h"
+#include "ToastMetrics.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <deque>
+#include <utility>
+#include <QFontMetricsF>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPropertyAnimation>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQuickWindow>
+#include <QSGRectangleNode>
+#include <QTimer>
+
+namespace {
+constexpr qreal MaximumTextWidth = 500;
+constexpr qreal DurationBarHeight = 4;
+
+/**
+ * @brief 进度条的填充部分：只有一个纯色矩形节点。
+ */
+class ToastQuickProgressChunk final : public QQuickItem
+{
+public:
+    explicit ToastQuickProgressChunk(QQuickItem *parent)
+        : QQuickItem(parent)
+    {
+        setFlag(ItemHasContents, true);
+    }
+
+    void setColor(const QColor &color)
+    {
+        m_color = color;
+        update();
+    }
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override
+    {
+        Q_UNUSED(data)
+        auto *node = static_cast<QSGRectangleNode *>(oldNode);
+        if (node == nullptr) {
+            node = window()->createRectangleNode();
+        }
+        node->setRect(boundingRect());
+        node->setColor(m_color);
+        return node;
+    }
+
+private:
+    QColor m_color;
+};
+
+QQmlEngine *engineOf(const QQuickItem *item)
+{
+    for (; item != nullptr; item = item->parentItem()) {
+        if (auto *engine = qmlEngine(item)) {
+            return engine;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 为目标创建一个数值动画。Animator 只以 QML 类型公开，因此通过宿主所属的 QML 引擎实例化，
+ *        它在渲染线程上直接修改场景图节点；宿主不属于任何 QML 引擎时回退为 QPropertyAnimation。
+ *        两者都有 start()、stop() 槽与 finished() 信号。
+ * @param target 目标 Item，同时作为动画的父对象。
+ * @param animator Animator 的 QML 类型名，例如 "OpacityAnimator"。
+ * @param property 该 Animator 作用的属性名，回退时由 QPropertyAnimation 驱动。
+ * @return 动画对象。
+ */
+QObject *createAnimation(QQuickItem *target, const char *animator, const char *property)
+{
+    if (QQmlEngine *engine = engineOf(target)) {
+        // 每个引擎每种类型只编译一次
+        static QHash<QPair<const QQmlEngine *, QByteArray>, QPointer<QQmlComponent>> s_components;
+        QPointer<QQmlComponent> &component = s_components[qMakePair(engine, QByteArray(animator))];
+        if (component.isNull()) {
+            component = new QQmlComponent(engine, engine);
+            component->setData(
+                QByteArrayLiteral("import QtQuick 2.12\n") + animator + QByteArrayLiteral(" {}"),
+                QUrl());
+        }
+        if (QObject *animation = component->create()) {
+            animation->setParent(target);
+            animation->setProperty("target", QVariant::fromValue(target));
+            return animation;
+        }
+    }
+    return new QPropertyAnimation(target, property, target);
+}
+
+void startAnimation(QObject *animation, qreal from, qreal to, int duration)
+{
+    if (auto *fallback = qobject_cast<QPropertyAnimation *>(animation)) {
+        fallback->stop();
+        fallback->setStartValue(from);
+        fallback->setEndValue(to);
+        fallback->setDuration(duration);
+        fallback->start();
+        return;
+    }
+    QMetaObject::invokeMethod(animation, "stop");
+    animation->setProperty("from", from);
+    animation->setProperty("to", to);
+    animation->setProperty("duration", duration);
+    QMetaObject::invokeMethod(animation, "start");
+}
+
+void stopAnimation(QObject *animation)
+{
+    // Animator 停止时把渲染线程上的当前值写回目标属性
+    QMetaObject::invokeMethod(animation, "stop");
+}
+
+bool isAnimationRunning(const QObject *animation)
+{
+    if (const auto *fallback = qobject_cast<const QPropertyAnimation *>(animation)) {
+        return fallback->state() == QAbstractAnimation::Running;
+    }
+    return animation->property("running").toBool();
+}
+} // namespace
+
+ToastQuickProgressBar::ToastQuickProgressBar(QQuickItem *parent)
+    : QQuickItem(parent)
+    , m_chunk(new ToastQuickProgressChunk(this))
+{
+    setFlag(ItemHasContents, true);
+    // 填充移出轨道的部分被裁剪掉
+    setClip(true);
+}
+
+qreal ToastQuickProgressBar::progress() const noexcept
+{
+    return width() > 0 ? std::clamp<qreal>(1 + m_chunk->x() / width(), 0, 1) : m_progress;
+}
+
+void ToastQuickProgressBar::setProgress(qreal progress)
+{
+    progress = std::clamp<qreal>(progress, 0, 1);
+    if (qFuzzyCompare(this->progress(), progress)) {
+        return;
+    }
+    m_progress = progress;
+    m_chunk->setX(-(1 - progress) * width());
+    emit progressChanged();
+}
+
+void ToastQuickProgressBar::setColors(const QColor &trackColor, const QColor &chunkColor)
+{
+    m_trackColor = trackColor;
+    static_cast<ToastQuickProgressChunk *>(m_chunk)->setColor(chunkColor);
+    update();
+}
+
+QQuickItem *ToastQuickProgressBar::chunk() const noexcept
+{
+    return m_chunk;
+}
+
+QSGNode *ToastQuickProgressBar::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+    // 轨道与填充都由场景图后端创建，软件后端同样适用
+    auto *track = static_cast<QSGRectangleNode *>(oldNode);
+    if (track == nullptr) {
+        track = window()->createRectangleNode();
+    }
+    track->setRect(boundingRect());
+    track->setColor(m_trackColor);
+    return track;
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+void ToastQuickProgressBar::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    layoutChunk(oldGeometry);
+}
+#else
+void ToastQuickProgressBar::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+    layoutChunk(oldGeometry);
+}
+#endif
+
+void ToastQuickProgressBar::layoutChunk(const QRectF &oldGeometry)
+{
+    // 按原宽度下的进度换算新的偏移
+    if (oldGeometry.width() > 0) {
+        m_progress = std::clamp<qreal>(1 + m_chunk->x() / oldGeometry.width(), 0, 1);
+    }
+    m_chunk->setSize(size());
+    m_chunk->setX(-(1 - m_progress) * width());
+}
+
+ToastQuickItem::ToastQuickItem(quint64 id, const ToastConfig &config, QQuickItem *parent)
+    : QQuickPaintedItem(parent)
+    , m_config(config)
+    , m_theme(config.theme())
+    , m_id(id)
+{
+    if (m_theme.isNull()) {
+        m_theme = ToastTheme::fromConfig(m_config);
+    }
+    setAntialiasing(true);
+    setAcceptHoverEvents(true);
+    setAcceptedMouseButtons(Qt::LeftButton);
+    setOpacity(0);
+
+    m_progressBar = new ToastQuickProgressBar(this);
+    QColor trackColor = m_config.durationBarColor();
+    trackColor.setAlpha(100);
+    m_progressBar->setColors(trackColor, m_config.durationBarColor());
+    m_progressBar->setVisible(m_config.showDurationBar());
+
+    // 倒计时由填充的位移动画驱动，动画结束即到期
+    m_progressAnimation = createAnimation(m_progressBar->chunk(), "XAnimator", "x");
+    connect(m_progressAnimation, SIGNAL(finished()), this, SLOT(dismiss()));
+    m_fadeInAnimation = createAnimation(this, "OpacityAnimator", "opacity");
+    m_xAnimation = createAnimation(this, "XAnimator", "x");
+    m_yAnimation = createAnimation(this, "YAnimator", "y");
+
+    layoutContent();
+}
+
+quint64 ToastQuickItem::id() const noexcept
+{
+    return m_id;
+}
+
+const ToastConfig &ToastQuickItem::config() const noexcept
+{
+    return m_config;
+}
+
+void ToastQuickItem::start()
+{
+    startAnimation(m_fadeInAnimation, 0, 1, m_config.fadeInDuration());
+    if (m_config.duration() != 0) {
+        startAnimation(m_progressAnimation, 0, -m_progressBar->width(), m_config.duration());
+    }
+}
+
+void ToastQuickItem::dismiss()
+{
+    if (m_dismissing) {
+        return;
+    }
+    m_dismissing = true;
+    stopAnimation(m_progressAnimation);
+    stopAnimation(m_fadeInAnimation);
+    QObject *fadeOutAnimation = createAnimation(this, "OpacityAnimator", "opacity");
+    connect(fadeOutAnimation, SIGNAL(finished()), this, SIGNAL(finished()));
+    startAnimation(fadeOutAnimation, opacity(), 0, m_config.fadeOutDuration());
+}
+
+bool ToastQuickItem::isDismissing() const noexcept
+{
+    return m_dismissing;
+}
+
+void ToastQuickItem::moveTo(const QPointF &position, int duration)
+{
+    stopAnimation(m_xAnimation);
+    stopAnimation(m_yAnimation);
+    if (duration <= 0) {
+        setPosition(position);
+        return;
+    }
+    startAnimation(m_xAnimation, x(), position.x(), duration);
+    startAnimation(m_yAnimation, y(), position.y(), duration);
+}
+
+void ToastQuickItem::paint(QPainter *painter)
+{
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(m_config.backgroundColor());
+    painter->drawRoundedRect(boundingRect(), m_config.borderRadius(), m_config.borderRadius());
+
+    if (!m_iconRect.isNull()) {
+        m_theme.icon().paint(painter, m_iconRect.toRect());
+    }
+    if (!m_iconSeparatorRect.isNull()) {
+        painter->fillRect(m_iconSeparatorRect, m_config.iconSeparatorColor());
+    }
+    if (!m_titleRect.isNull()) {
+        painter->setFont(m_config.titleFont());
+        painter->setPen(m_config.titleColor());
+        painter->drawText(m_titleRect, Qt::TextWordWrap | Qt::AlignLeft, m_title);
+    }
+    if (!m_textRect.isNull()) {
+        painter->setFont(m_config.textFont());
+        painter->setPen(m_config.textColor());
+        painter->drawText(m_textRect, Qt::TextWordWrap | Qt::AlignLeft, m_text);
+    }
+    if (!m_closeButtonRect.isNull()) {
+        QRectF iconRect(QPointF(), QSizeF(m_config.closeButtonIconSize()));
+        iconRect.moveCenter(m_closeButtonRect.center());
+        m_theme.closeButtonIcon().paint(painter, iconRect.toRect());
+    }
+}
+
+void ToastQuickItem::hoverEnterEvent(QHoverEvent *event)
+{
+    if (m_config.duration() != 0 && m_config.resetDurationOnHover()
+        && isAnimationRunning(m_progressAnimation)) {
+        stopAnimation(m_progressAnimation);
+        m_progressBar->setProgress(1.0);
+    }
+    QQuickPaintedItem::hoverEnterEvent(event);
+}
+
+void ToastQuickItem::hoverLeaveEvent(QHoverEvent *event)
+{
+    if (m_config.duration() != 0 && m_config.resetDurationOnHover() && !m_dismissing
+        && !isAnimationRunning(m_progressAnimation)) {
+        startAnimation(m_progressAnimation, 0, -m_progressBar->width(), m_config.duration());
+    }
+    QQuickPaintedItem::hoverLeaveEvent(event);
+}
+
+void ToastQuickItem::mousePressEvent(QMouseEvent *event)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    const QPointF position = event->position();
+#else
+    const QPointF position = event->localPos();
+#endif
+    if (m_closeButtonRect.contains(position)) {
+        dismiss();
+        event->accept();
+        return;
+    }
+    QQuickPaintedItem::mousePressEvent(event);
+}
+
+void ToastQuickItem::layoutContent()
+{
+    // 与 QWidget 后端相同的水平结构：图标 | 分隔线 | 标题与文本 | 关闭按钮
+    const QFontMetricsF titleFM(m_config.titleFont());
+    const QFontMetricsF textFM(m_config.textFont());
+    const QRectF bounds(0, 0, MaximumTextWidth, INT_MAX);
+
+    m_title = ToastConfig::elidedText(
+        m_config.title(), m_config.textCharacterLimit(), m_config.textLineLimit());
+    m_text = ToastConfig::elidedText(
+        m_config.text(), m_config.textCharacterLimit(), m_config.textLineLimit());
+    QSizeF titleSize;
+    if (!m_title.isEmpty()) {
+        titleSize = titleFM.boundingRect(bounds, Qt::TextWordWrap | Qt::AlignLeft, m_title).size();
+    }
+    QSizeF textSize;
+    if (!m_text.isEmpty()) {
+        textSize = textFM.boundingRect(bounds, Qt::TextWordWrap | Qt::AlignLeft, m_text).size();
+    }
+    const qreal textWidth = std::ceil(std::max(titleSize.width(), textSize.width())) + 1;
+    const qreal contentHeight = titleSize.height()
+                                + (!titleSize.isEmpty() && !textSize.isEmpty()
+                                       ? m_config.textSectionSpacing()
+                                       : 0)
+                                + textSize.height();
+    qreal sectionHeight = contentHeight;
+    if (m_config.showIcon()) {
+        sectionHeight = std::max<qreal>(sectionHeight, m_config.iconSize().height());
+    }
+
+    const QMargins &margins = m_config.margins();
+    const qreal top = margins.top();
+    qreal x = margins.left();
+
+    m_iconRect = QRectF();
+    m_iconSeparatorRect = QRectF();
+    if (m_config.showIcon()) {
+        const QMargins &iconMargins = m_config.iconMargins();
+        const QSizeF iconSize(m_config.iconSize());
+        const QPointF iconPosition(
+            x + iconMargins.left(), top + (sectionHeight - iconSize.height()) / 2);
+        m_iconRect = QRectF(iconPosition, iconSize);
+        x += iconMargins.left() + iconSize.width() + iconMargins.right();
+        if (m_config.showIconSeparator()) {
+            m_iconSeparatorRect = QRectF(x, top, m_config.iconSeparatorWidth(), sectionHeight);
+            x += m_config.iconSeparatorWidth() + m_config.iconSectionMargins().right();
+        }
+    }
+
+    const QMargins &textMargins = m_config.textSectionMargins();
+    x += textMargins.left();
+    const qreal textTop = top + (sectionHeight - contentHeight) / 2;
+    m_titleRect = titleSize.isEmpty() ? QRectF()
+                                      : QRectF(x, textTop, textWidth, titleSize.height());
+    m_textRect = textSize.isEmpty() ? QRectF()
+                                    : QRectF(
+                                          x,
+                                          textTop + contentHeight - textSize.height(),
+                                          textWidth,
+                                          textSize.height());
+    x += textWidth + textMargins.right();
+
+    m_closeButtonRect = QRectF();
+    if (m_config.showCloseButton()) {
+        const QMargins &closeMargins = m_config.closeButtonMargins();
+        const QSizeF closeSize(m_config.closeButtonSize());
+        qreal closeTop = top + (sectionHeight - closeSize.height()) / 2;
+        if (m_config.closeButtonAlignment() == ToastButtonAlignment::Top) {
+            closeTop = top + closeMargins.top();
+        } else if (m_config.closeButtonAlignment() == ToastButtonAlignment::Bottom) {
+            closeTop = top + sectionHeight - closeSize.height() - closeMargins.bottom();
+        }
+        m_closeButtonRect = QRectF(QPointF(x + closeMargins.left(), closeTop), closeSize);
+        x += closeMargins.left() + closeSize.width() + closeMargins.right();
+    }
+
+    const qreal width = x + margins.right();
+    const qreal height = top + sectionHeight + margins.bottom()
+                         + (m_config.showDurationBar() ? DurationBarHeight : 0);
+    setSize(QSizeF(width, height));
+    m_progressBar->setPosition(QPointF(0, height - DurationBarHeight));
+    m_progressBar->setSize(QSizeF(width, DurationBarHeight));
+    update();
+}
+
+ToastQuickManager &ToastQuickManager::instance() noexcept
+{
+    static ToastQuickManager s_instance;
+    return s_instance;
+}
+
+ToastQuickManager::ToastQuickManager()
+    : m_scheduler(this)
+{}
+
+void ToastQuickManager::registerQmlTypes(const char *uri)
+{
+    qmlRegisterSingletonType<ToastQuickManager>(
+        uri, 1, 0, "ToastManager", [](QQmlEngine *, QJSEngine *) -> QObject * {
+            auto *manager = &ToastQuickManager::instance();
+            QQmlEngine::setObjectOwnership(manager, QQmlEngine::CppOwnership);
+            return manager;
+        });
+    qmlRegisterType<ToastQuickHost>(uri, 1, 0, "ToastHost");
+}
+
+QQuickItem *ToastQuickManager::host() const noexcept
+{
+    return m_host;
+}
+
+ToastQuickManager &ToastQuickManager::setHost(QQuickItem *host)
+{
+    if (m_host == host) {
+        return *this;
+    }
+    if (m_host != nullptr) {
+        disconnect(m_host, nullptr, this, nullptr);
+        // 旧宿主上的 Toast 直接移除，不再跨宿主迁移
+        for (auto *item : std::as_const(m_currentlyShown)) {
+            item->deleteLater();
+        }
+        removeAllItems();
+    }
+    m_host = host;
+    if (host != nullptr) {
+        connect(host, &QQuickItem::widthChanged, this, &ToastQuickManager::updateAllPositions);
+        connect(host, &QQuickItem::heightChanged, this, &ToastQuickManager::updateAllPositions);
+        connect(host, &QObject::destroyed, this, [this]() {
+            // Toast 作为宿主的子对象一同销毁
+            removeAllItems();
+            emit countChanged();
+        });
+    }
+    presentNext();
+    emit countChanged();
+    return *this;
+}
+
+quint64 ToastQuickManager::present(const ToastConfig &config)
+{
+    const quint64 id = m_nextId++;
+    syncPolicy();
+    m_queue.emplace(id, QueuedToast{config, ToastMetrics::now()});
+    m_scheduler.present({id, QSize(), config.duration()});
+    emit countChanged();
+    return id;
+}
+
+quint64 ToastQuickManager::show(
+    const QString &title, const QString &text, const QString &theme, int duration)
+{
+    ToastConfig config;
+    if (!theme.isEmpty()) {
+        config.setTheme(theme);
+    }
+    config.setTitle(title).setText(text).setDuration(duration);
+    return present(config);
+}
+
+quint64 ToastQuickManager::success(const QString &title, const QString &text, int duration)
+{
+    return show(title, text, QStringLiteral("success"), duration);
+}
+
+quint64 ToastQuickManager::warning(const QString &title, const QString &text, int duration)
+{
+    return show(title, text, QStringLiteral("warning"), duration);
+}
+
+quint64 ToastQuickManager::error(const QString &title, const QString &text, int duration)
+{
+    return show(title, text, QStringLiteral("error"), duration);
+}
+
+quint64 ToastQuickManager::information(const QString &title, const QString &text, int duration)
+{
+    return show(title, text, QStringLiteral("information"), duration);
+}
+
+void ToastQuickManager::close(quint64 id)
+{
+    if (m_scheduler.cancel(id)) {
+        emit countChanged();
+        return;
+    }
+    if (auto *item = m_currentlyShown.value(id)) {
+        item->dismiss();
+    }
+}
+
+void ToastQuickManager::reset()
+{
+    for (auto *item : std::as_const(m_currentlyShown)) {
+        item->deleteLater();
+    }
+    m_currentlyShown.clear();
+    m_queue.clear();
+    m_scheduler.clear();
+    emit countChanged();
+}
+
+void ToastQuickManager::updateAllPositions()
+{
+    syncPolicy();
+    m_scheduler.relayout();
+}
+
+int ToastQuickManager::count() const noexcept
+{
+    return m_scheduler.count();
+}
+
+int ToastQuickManager::visibleCount() const noexcept
+{
+    return m_scheduler.visibleCount();
+}
+
+int ToastQuickManager::queuedCount() const noexcept
+{
+    return m_scheduler.queuedCount();
+}
+
+const ToastScheduler &ToastQuickManager::scheduler() const noexcept
+{
+    return m_scheduler;
+}
+
+void ToastQuickManager::complete(ToastQuickItem *item)
+{
+    if (m_currentlyShown.remove(item->id()) > 0) {
+        syncPolicy();
+        m_scheduler.complete(item->id());
+        QTimer::singleShot(item->config().fadeInDuration(), this, [this]() { presentNext(); });
+    }
+    item->deleteLater();
+    emit countChanged();
+}
+
+void ToastQuickManager::presentNext()
+{
+    syncPolicy();
+    bool changed = false;
+    while (m_scheduler.promoteNext()) {
+        changed = true;
+    }
+    if (changed) {
+        emit countChanged();
+    }
+}
+
+void ToastQuickManager::syncPolicy() noexcept
+{
+    // 没有宿主时容量为 0，所有 Toast 都在队列中等待
+    const auto &config = ToastGlobalConfig::instance();
+    m_scheduler.setCapacity(m_host != nullptr ? config.maximumOnScreen() : 0);
+    m_scheduler.setSpacing(config.spacing());
+}
+
+void ToastQuickManager::removeAllItems()
+{
+    m_currentlyShown.clear();
+    const std::deque<ToastEntry> visible = m_scheduler.visible();
+    for (const auto &entry : visible) {
+        m_scheduler.complete(entry.id);
+    }
+}
+
+QPointF ToastQuickManager::calculatePosition(const ToastQuickItem *item) const
+{
+    if (m_host == nullptr) {
+        return QPointF();
+    }
+    const auto &global = ToastGlobalConfig::instance();
+    const qreal offsetY = m_scheduler.offsetOf(item->id());
+    const qreal areaWidth = m_host->width();
+    const qreal areaHeight = m_host->height();
+    const qreal gOffsetX = global.offsetX();
+    const qreal gOffsetY = global.offsetY();
+    const auto gPosition = global.position();
+    qreal x = 0;
+    qreal y = 0;
+    if (gPosition == ToastPosition::BottomRight || gPosition == ToastPosition::TopRight) {
+        x = areaWidth - item->width() - gOffsetX;
+    } else if (gPosition == ToastPosition::BottomLeft || gPosition == ToastPosition::TopLeft) {
+        x = gOffsetX;
+    } else {
+        x = areaWidth / 2 - item->width() / 2;
+    }
+    if (gPosition == ToastPosition::BottomRight || gPosition == ToastPosition::BottomLeft
+        || gPosition == ToastPosition::BottomMiddle) {
+        y = areaHeight - item->height() - gOffsetY - offsetY;
+    } else if (gPosition == ToastPosition::Center) {
+        y = areaHeight / 2 - item->height() / 2 + offsetY;
+    } else {
+        y = gOffsetY + offsetY;
+    }
+    return QPointF(x, y);
+}
+
+bool ToastQuickManager::showEntry(const ToastEntry &entry)
+{
+    auto it = m_queue.find(entry.id);
+    if (it == m_queue.end() || m_host == nullptr) {
+        return false;
+    }
+    if (it->second.config.isExpired(ToastMetrics::now() - it->second.presentedAt)) {
+        // 与 QWidget 后端一致：只在排到显示时检查一次，调度器跳过它并提升下一条
+        m_queue.erase(it);
+        return false;
+    }
+    const ToastConfig config = std::move(it->second.config);
+    m_queue.erase(it);
+
+    auto *item = new ToastQuickItem(entry.id, config, m_host);
+    item->setZ(1);
+    m_currentlyShown.insert(entry.id, item);
+    m_scheduler.resize(entry.id, item->size().toSize());
+    connect(item, &ToastQuickItem::finished, this, [this, item]() { complete(item); });
+
+    // 与 QWidget 后端一致：非第一个 Toast 从偏移处滑入
+    const QPointF position = calculatePosition(item);
+    const auto *predecessor = m_currentlyShown.value(m_scheduler.predecessorOf(entry.id));
+    if (predecessor != nullptr) {
+        const qreal predecessorDifferenceY = std::abs(
+            predecessor->y() - calculatePosition(predecessor).y());
+        const qreal offset = item->height() / 1.5 + predecessorDifferenceY;
+        const auto gPosition = ToastGlobalConfig::instance().position();
+        const bool fromAbove = gPosition == ToastPosition::BottomRight
+                               || gPosition == ToastPosition::BottomLeft
+                               || gPosition == ToastPosition::BottomMiddle;
+        item->setPosition(QPointF(position.x(), position.y() + (fromAbove ? -offset : offset)));
+        item->moveTo(position, config.fadeInDuration());
+    } else {
+        item->setPosition(position);
+    }
+    item->start();
+    return true;
+}
+
+void ToastQuickManager::moveEntry(const ToastEntry &entry, int offsetY)
+{
+    Q_UNUSED(offsetY)
+    if (auto *item = m_currentlyShown.value(entry.id)) {
+        item->moveTo(calculatePosition(item), ToastGlobalConfig::UpdatePositionDuration);
+    }
+}
+
+void ToastQuickManager::dropEntry(quint64 id)
+{
+    m_queue.erase(id);
+}
+
+ToastQuickHost::ToastQuickHost(QQuickItem *parent)
+    : QQuickItem(parent)
+{}
+
+void ToastQuickHost::componentComplete()
+{
+    QQuickItem::componentComplete();
+    ToastQuickManager::instance().setHost(this);
+}
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "ToastConfig.h"
+#include "ToastScheduler.h"
+#include <unordered_map>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QQuickPaintedItem>
+
+/**
+ * @brief Qt Quick 后端的倒计时进度条。轨道是自身的矩形节点，填充是一个被裁剪的子 Item；
+ *        倒计时只把填充向左移出裁剪区域，可以交给渲染线程上的 XAnimator，不会触发任何 QPainter 重绘。
+ *
+ */
+class QTTOAST_EXPORT ToastQuickProgressBar final : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(qreal progress READ progress WRITE setProgress NOTIFY progressChanged)
+
+public:
+    explicit ToastQuickProgressBar(QQuickItem *parent = nullptr);
+
+    /**
+     * @brief 获取当前进度。Animator 运行期间只在其停止或结束时同步。
+     * @return 进度值，范围 [0, 1]。
+     */
+    [[nodiscard]] qreal progress() const noexcept;
+
+    /**
+     * @brief 设置当前进度。
+     * @param progress 进度值，范围 [0, 1]。
+     */
+    void setProgress(qreal progress);
+
+    /**
+     * @brief 设置进度条的轨道与填充颜色。
+     * @param trackColor 轨道颜色。
+     * @param chunkColor 填充颜色。
+     */
+    void setColors(const QColor &trackColor, const QColor &chunkColor);
+
+    /**
+     * @brief 获取填充部分。进度 p 对应其 x 为 -(1 - p) * width()。
+     * @return 填充 Item。
+     */
+    [[nodiscard]] QQuickItem *chunk() const noexcept;
+
+signals:
+    void progressChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+#else
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+#endif
+
+private:
+    void layoutChunk(const QRectF &oldGeometry);
+
+    qreal m_progress{1.0}; ///< 宽度为 0 时保存的进度，有宽度后按它放置填充
+    QColor m_trackColor;
+    QQuickItem *m_chunk{nullptr};
+};
+
+/**
+ * @brief Qt Quick 后端的单个 Toast。静态内容（背景、图标、文本、关闭图标）只在布局时绘制一次，
+ *        淡入淡出、位移与倒计时均通过场景图的不透明度、变换和矩形节点完成，与 QWidget 后端共享 ToastConfig。
+ *        宿主属于 QML 引擎时这些动画是渲染线程上的 Animator，GUI 线程阻塞时仍然流畅；
+ *        否则回退为 GUI 线程上的 QPropertyAnimation。
+ *
+ */
+class QTTOAST_EXPORT ToastQuickItem final : public QQuickPaintedItem
+{
+    Q_OBJECT
+
+public:
+    explicit ToastQuickItem(quint64 id, const ToastConfig &config, QQuickItem *parent = nullptr);
+
+    /**
+     * @brief 获取 Toast 的唯一标识。
+     * @return 标识值。
+     */
+    [[nodiscard]] quint64 id() const noexcept;
+
+    /**
+     * @brief 获取 Toast 的配置。
+     * @return 配置的常量引用。
+     */
+    [[nodiscard]] const ToastConfig &config() const noexcept;
+
+    /**
+     * @brief 开始显示：淡入并启动倒计时。
+     */
+    void start();
+
+    /**
+     * @brief 查询 Toast 是否正在淡出。
+     * @return 正在淡出时返回 true。
+     */
+    [[nodiscard]] bool isDismissing() const noexcept;
+
+    /**
+     * @brief 将 Toast 移动到指定位置。
+     * @param position 目标位置（宿主坐标）。
+     * @param duration 动画时长（毫秒），为 0 时立即移动。
+     */
+    void moveTo(const QPointF &position, int duration);
+
+    void paint(QPainter *painter) override;
+
+public slots:
+    /**
+     * @brief 淡出 Toast，结束后发出 finished 信号。
+     */
+    void dismiss();
+
+signals:
+    void finished();
+
+protected:
+    void hoverEnterEvent(QHoverEvent *event) override;
+    void hoverLeaveEvent(QHoverEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+
+private:
+    void layoutContent();
+
+    ToastConfig m_config;
+    ToastTheme m_theme;
+    quint64 m_id{0};
+    bool m_dismissing{false};
+    ToastQuickProgressBar *m_progressBar{nullptr};
+    QObject *m_progressAnimation{nullptr}; ///< 填充的 XAnimator（或回退的 QPropertyAnimation）
+    QObject *m_fadeInAnimation{nullptr};
+    QObject *m_xAnimation{nullptr};
+    QObject *m_yAnimation{nullptr};
+    QString m_title; ///< 按长度限制截断后的标题，测量与绘制都只使用它
+    QString m_text;  ///< 按长度限制截断后的正文
+    QRectF m_iconRect;
+    QRectF m_iconSeparatorRect;
+    QRectF m_titleRect;
+    QRectF m_textRect;
+    QRectF m_closeButtonRect;
+};
+
+/**
+ * @brief Qt Quick 后端的管理类，以 QML 单例 ToastManager 注册。
+ *        与 ToastManager 一样作为 ToastScheduler 的渲染器，并读取同一份 ToastGlobalConfig。
+ *        支持队列存活时间与过期时刻；免打扰、应用隐藏时暂停和自适应降级只由 QWidget 后端的 ToastManager 提供。
+ *
+ */
+class QTTOAST_EXPORT ToastQuickManager final : public QObject, private ToastRenderer
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(int visibleCount READ visibleCount NOTIFY countChanged)
+    Q_PROPERTY(int queuedCount READ queuedCount NOTIFY countChanged)
+
+public:
+    static ToastQuickManager &instance() noexcept;
+
+    Q_DISABLE_COPY_MOVE(ToastQuickManager)
+
+    /**
+     * @brief 注册 QML 类型：单例 ToastManager 与可放置的 ToastHost 元素。
+     * @param uri QML 模块名。
+     */
+    static void registerQmlTypes(const char *uri = "QtToast");
+
+    /**
+     * @brief 获取承载 Toast 的宿主 Item。
+     * @return 宿主 Item，未设置时返回 nullptr。
+     */
+    [[nodiscard]] QQuickItem *host() const noexcept;
+
+    /**
+     * @brief 设置承载 Toast 的宿主 Item，Toast 按宿主的几何定位。设置后立即显示排队中的 Toast。
+     * @param host 宿主 Item。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastQuickManager &setHost(QQuickItem *host);
+
+    /**
+     * @brief 请求显示一个 Toast。如果达到最大显示数量或尚无宿主，则将其加入队列。
+     * @param config Toast 配置。
+     * @return Toast 的唯一标识。
+     */
+    quint64 present(const ToastConfig &config);
+
+    /**
+     * @brief 按主题名称显示一个 Toast。
+     * @param title 标题。
+     * @param text 文本。
+     * @param theme 已注册的主题名称（例如 "success"、"error-dark"），为空时使用默认外观。
+     * @param duration 持续时间（毫秒），0 表示不自动关闭。
+     * @return Toast 的唯一标识。
+     */
+    Q_INVOKABLE quint64 show(
+        const QString &title,
+        const QString &text,
+        const QString &theme = QString(),
+        int duration = 5000);
+
+    Q_INVOKABLE quint64 success(const QString &title, const QString &text, int duration = 5000);
+    Q_INVOKABLE quint64 warning(const QString &title, const QString &text, int duration = 5000);
+    Q_INVOKABLE quint64 error(const QString &title, const QString &text, int duration = 5000);
+    Q_INVOKABLE quint64 information(const QString &title, const QString &text, int duration = 5000);
+
+    /**
+     * @brief 关闭指定的 Toast：排队中的直接移出队列，显示中的执行淡出。
+     * @param id Toast 的唯一标识。
+     */
+    Q_INVOKABLE void close(quint64 id);
+
+    /**
+     * @brief 立即移除所有显示中和排队中的 Toast。
+     */
+    Q_INVOKABLE void reset();
+
+    /**
+     * @brief 按当前顺序重新计算所有显示中 Toast 的位置。
+     */
+    Q_INVOKABLE void updateAllPositions();
+
+    [[nodiscard]] int count() const noexcept;
+    [[nodiscard]] int visibleCount() const noexcept;
+    [[nodiscard]] int queuedCount() const noexcept;
+
+    /**
+     * @brief 获取决定队列、最大显示数量与堆叠偏移的调度核心。
+     * @return 调度器的常量引用。
+     */
+    [[nodiscard]] const ToastScheduler &scheduler() const noexcept;
+
+signals:
+    void countChanged();
+
+private:
+    explicit ToastQuickManager();
+
+    void complete(ToastQuickItem *item);
+    void presentNext();
+    void syncPolicy() noexcept;
+    void removeAllItems();
+    [[nodiscard]] QPointF calculatePosition(const ToastQuickItem *item) const;
+
+    // ToastRenderer
+    bool showEntry(const ToastEntry &entry) override;
+    void moveEntry(const ToastEntry &entry, int offsetY) override;
+    void dropEntry(quint64 id) override;
+
+    QPointer<QQuickItem> m_host;
+    ToastScheduler m_scheduler;
+    QHash<quint64, ToastQuickItem *> m_currentlyShown;
+    struct QueuedToast
+    {
+        ToastConfig config;
+        qint64 presentedAt{0}; ///< 提交时间（ToastMetrics::now()）
+    };
+
+    std::unordered_map<quint64, QueuedToast> m_queue;
+    quint64 m_nextId{1};
+};
+
+/**
+ * @brief 可在 QML 中放置的 Toast 宿主元素，通常铺满窗口：`ToastHost { anchors.fill: parent }`。
+ *        完成创建后自动成为 ToastQuickManager 的宿主。
+ *
+ */
+class QTTOAST_EXPORT ToastQuickHost final : public QQuickItem
+{
+    Q_OBJECT
+
+public:
+    explicit ToastQuickHost(QQuickItem *parent = nullptr);
+
+protected:
+    void componentComplete() override;
+};
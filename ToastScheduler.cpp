@@ -0,0 +1,235 @@
+#include "ToastScheduler.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace {
+template<typename Container>
+auto findEntry(Container &entries, quint64 id) noexcept
+{
+    return std::find_if(entries.begin(), entries.end(), [id](const ToastEntry &entry) {
+        return entry.id == id;
+    });
+}
+} // namespace
+
+ToastScheduler::ToastScheduler(ToastRenderer *renderer) noexcept
+    : m_renderer(renderer)
+{}
+
+ToastRenderer *ToastScheduler::renderer() const noexcept
+{
+    return m_renderer;
+}
+
+ToastScheduler &ToastScheduler::setRenderer(ToastRenderer *renderer) noexcept
+{
+    m_renderer = renderer;
+    return *this;
+}
+
+int ToastScheduler::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+ToastScheduler &ToastScheduler::setCapacity(int capacity) noexcept
+{
+    m_capacity = std::max(0, capacity);
+    return *this;
+}
+
+int ToastScheduler::spacing() const noexcept
+{
+    return m_spacing;
+}
+
+ToastScheduler &ToastScheduler::setSpacing(int spacing) noexcept
+{
+    m_spacing = spacing;
+    return *this;
+}
+
+bool ToastScheduler::present(const ToastEntry &entry)
+{
+    if (hasRoom()) {
+        return show(entry);
+    }
+    m_queue.push_back(entry);
+    return false;
+}
+
+bool ToastScheduler::presentInSequence(const ToastEntry &entry)
+{
+    if (hasRoom()) {
+        return show(entry);
+    }
+    const auto later = std::find_if(m_queue.begin(), m_queue.end(),
+                                    [&entry](const ToastEntry &queued) {
+                                        return queued.sequence > entry.sequence;
+                                    });
+    m_queue.insert(later, entry);
+    return false;
+}
+
+bool ToastScheduler::complete(quint64 id)
+{
+    auto it = findEntry(m_visible, id);
+    if (it == m_visible.end()) {
+        return false;
+    }
+    const auto index = static_cast<size_t>(it - m_visible.begin());
+    m_visible.erase(it);
+    relayoutFrom(index);
+    return true;
+}
+
+bool ToastScheduler::cancel(quint64 id)
+{
+    auto it = findEntry(m_queue, id);
+    if (it == m_queue.end()) {
+        return false;
+    }
+    m_queue.erase(it);
+    if (m_renderer != nullptr) {
+        m_renderer->dropEntry(id);
+    }
+    return true;
+}
+
+bool ToastScheduler::promoteNext()
+{
+    while (hasRoom() && !m_queue.empty()) {
+        ToastEntry entry = m_queue.front();
+        m_queue.pop_front();
+        if (show(entry)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ToastScheduler::resize(quint64 id, const QSize &size)
+{
+    auto it = findEntry(m_visible, id);
+    if (it == m_visible.end()) {
+        it = findEntry(m_queue, id);
+        if (it != m_queue.end()) {
+            it->size = size;
+        }
+        return;
+    }
+    const bool heightChanged = it->size.height() != size.height();
+    it->size = size;
+    if (heightChanged) {
+        relayoutFrom(static_cast<size_t>(it - m_visible.begin()) + 1);
+    }
+}
+
+void ToastScheduler::relayout()
+{
+    relayoutFrom(0);
+}
+
+void ToastScheduler::clear() noexcept
+{
+    m_visible.clear();
+    m_queue.clear();
+}
+
+int ToastScheduler::offsetOf(quint64 id) const noexcept
+{
+    int offset = 0;
+    for (const auto &entry : m_visible) {
+        if (entry.id == id) {
+            break;
+        }
+        offset += entry.size.height() + m_spacing;
+    }
+    return offset;
+}
+
+quint64 ToastScheduler::predecessorOf(quint64 id) const noexcept
+{
+    quint64 previous = 0;
+    for (const auto &entry : m_visible) {
+        if (entry.id == id) {
+            return previous;
+        }
+        previous = entry.id;
+    }
+    return previous;
+}
+
+bool ToastScheduler::isVisible(quint64 id) const noexcept
+{
+    return findEntry(m_visible, id) != m_visible.end();
+}
+
+bool ToastScheduler::isQueued(quint64 id) const noexcept
+{
+    return findEntry(m_queue, id) != m_queue.end();
+}
+
+int ToastScheduler::count() const noexcept
+{
+    return static_cast<int>(m_visible.size() + m_queue.size());
+}
+
+int ToastScheduler::visibleCount() const noexcept
+{
+    return static_cast<int>(m_visible.size());
+}
+
+int ToastScheduler::queuedCount() const noexcept
+{
+    return static_cast<int>(m_queue.size());
+}
+
+const std::deque<ToastEntry> &ToastScheduler::visible() const noexcept
+{
+    return m_visible;
+}
+
+const std::deque<ToastEntry> &ToastScheduler::queued() const noexcept
+{
+    return m_queue;
+}
+
+bool ToastScheduler::hasRoom() const noexcept
+{
+    return m_visible.size() < static_cast<size_t>(m_capacity);
+}
+
+bool ToastScheduler::show(ToastEntry entry)
+{
+    const quint64 id = entry.id;
+    // 先加入可见列表，渲染器在回调中即可查询偏移或更新尺寸
+    m_visible.push_back(std::move(entry));
+    if (m_renderer == nullptr || m_renderer->showEntry(m_visible.back())) {
+        return true;
+    }
+    auto it = findEntry(m_visible, id);
+    if (it != m_visible.end()) {
+        m_visible.erase(it);
+    }
+    return false;
+}
+
+void ToastScheduler::relayoutFrom(size_t index)
+{
+    if (m_renderer == nullptr || index >= m_visible.size()) {
+        return;
+    }
+    int offset = 0;
+    for (size_t i = 0; i < index; i++) {
+        offset += m_visible.at(i).size.height() + m_spacing;
+    }
+    // 复制一份，渲染器在回调中修改调度器时不会使迭代失效
+    const auto first = m_visible.begin() + static_cast<std::ptrdiff_t>(index);
+    const std::deque<ToastEntry> entries(first, m_visible.end());
+    for (const auto &entry : entries) {
+        m_renderer->moveEntry(entry, offset);
+        offset += entry.size.height() + m_spacing;
+    }
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "ToastGlobal.h"
+#include <climits>
+#include <deque>
+#include <QSize>
+
+/**
+ * @brief 调度器中的一个 Toast：只包含唯一标识、尺寸与持续时间，不引用任何控件。
+ */
+struct ToastEntry
+{
+    quint64 id{0};       ///< 唯一标识
+    QSize size;          ///< 显示尺寸，堆叠偏移只使用其高度
+    int duration{0};     ///< 持续时间（毫秒），0 表示不自动关闭
+    quint64 sequence{0}; ///< 提交序号，按进入队列的先后递增；只用于 presentInSequence() 的排序
+};
+
+/**
+ * @brief 渲染器接口。调度器决定何时显示、移动与丢弃 Toast，渲染器负责具体的表现形式。
+ *
+ */
+class QTTOAST_EXPORT ToastRenderer
+{
+public:
+    virtual ~ToastRenderer() = default;
+
+    /**
+     * @brief 条目刚成为可见，渲染器应创建并显示对应的 Toast。
+     * @param entry 条目，回调期间可以通过 ToastScheduler::resize 更新其尺寸。
+     * @return 如果该 Toast 已无法显示（例如已被删除）则返回 false，调度器将丢弃该条目。
+     */
+    virtual bool showEntry(const ToastEntry &entry) = 0;
+
+    /**
+     * @brief 可见条目的堆叠偏移发生了变化。
+     * @param entry 条目。
+     * @param offsetY 相对锚定位置的堆叠偏移（像素）。
+     */
+    virtual void moveEntry(const ToastEntry &entry, int offsetY) = 0;
+
+    /**
+     * @brief 条目在显示之前被移出队列。
+     * @param id 条目的唯一标识。
+     */
+    virtual void dropEntry(quint64 id) = 0;
+};
+
+/**
+ * @brief 与 QWidget、屏幕无关的调度核心：负责队列、最大显示数量和堆叠偏移。
+ *        ToastManager 与 ToastQuickManager 都只是它的渲染器，因此可以在没有显示设备的环境下单独运行和测量。
+ *
+ */
+class QTTOAST_EXPORT ToastScheduler final
+{
+public:
+    explicit ToastScheduler(ToastRenderer *renderer = nullptr) noexcept;
+
+    Q_DISABLE_COPY_MOVE(ToastScheduler)
+
+    /**
+     * @brief 获取当前渲染器。
+     * @return 渲染器指针，可为 nullptr。
+     */
+    [[nodiscard]] ToastRenderer *renderer() const noexcept;
+
+    /**
+     * @brief 设置渲染器。为 nullptr 时调度器只维护状态，不发出任何回调。
+     * @param renderer 渲染器指针。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastScheduler &setRenderer(ToastRenderer *renderer) noexcept;
+
+    /**
+     * @brief 获取同时可见的最大数量。
+     * @return 最大数量。
+     */
+    [[nodiscard]] int capacity() const noexcept;
+
+    /**
+     * @brief 设置同时可见的最大数量。不会立即提升排队中的条目，需要时调用 promoteNext()。
+     * @param capacity 最大数量，小于 0 时按 0 处理。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastScheduler &setCapacity(int capacity) noexcept;
+
+    /**
+     * @brief 获取相邻 Toast 之间的间距。
+     * @return 间距（像素）。
+     */
+    [[nodiscard]] int spacing() const noexcept;
+
+    /**
+     * @brief 设置相邻 Toast 之间的间距。
+     * @param spacing 间距（像素）。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastScheduler &setSpacing(int spacing) noexcept;
+
+    /**
+     * @brief 提交一个条目：有空位时立即显示，否则加入队列末尾。
+     * @param entry 条目。
+     * @return 如果已立即显示则返回 true。
+     */
+    bool present(const ToastEntry &entry);
+
+    /**
+     * @brief 重新提交一个曾被暂缓的条目：有空位时立即显示，否则按提交序号插入队列，
+     *        排在序号更大（提交更晚）的条目之前，使其保持原有的先后顺序。
+     * @param entry 条目，其 sequence 为首次提交时记录的提交序号。
+     * @return 如果已立即显示则返回 true。
+     */
+    bool presentInSequence(const ToastEntry &entry);
+
+    /**
+     * @brief 结束一个可见条目，并通知其余可见条目新的堆叠偏移。不会自动提升排队中的条目。
+     * @param id 条目的唯一标识。
+     * @return 如果该条目可见并已被移除则返回 true。
+     */
+    bool complete(quint64 id);
+
+    /**
+     * @brief 将一个条目移出队列，并通过 dropEntry 通知渲染器。
+     * @param id 条目的唯一标识。
+     * @return 如果该条目在队列中并已被移除则返回 true。
+     */
+    bool cancel(quint64 id);
+
+    /**
+     * @brief 若有空位，按顺序显示下一个排队中的条目；渲染器拒绝显示的条目会被跳过。
+     * @return 如果显示了一个条目则返回 true。
+     */
+    bool promoteNext();
+
+    /**
+     * @brief 更新条目的尺寸。可见条目高度改变时通知其后的条目新的堆叠偏移。
+     * @param id 条目的唯一标识。
+     * @param size 新尺寸。
+     */
+    void resize(quint64 id, const QSize &size);
+
+    /**
+     * @brief 通知渲染器所有可见条目的当前堆叠偏移。
+     */
+    void relayout();
+
+    /**
+     * @brief 清空所有可见与排队中的条目，不发出任何回调。
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 计算可见条目的堆叠偏移：排在它之前的所有可见条目的高度与间距之和。
+     * @param id 条目的唯一标识。
+     * @return 偏移（像素）；条目不可见时返回所有可见条目的总偏移。
+     */
+    [[nodiscard]] int offsetOf(quint64 id) const noexcept;
+
+    /**
+     * @brief 获取排在指定可见条目之前的可见条目。
+     * @param id 条目的唯一标识。
+     * @return 前一个条目的标识；没有时返回 0；条目不可见时返回最后一个可见条目。
+     */
+    [[nodiscard]] quint64 predecessorOf(quint64 id) const noexcept;
+
+    [[nodiscard]] bool isVisible(quint64 id) const noexcept;
+    [[nodiscard]] bool isQueued(quint64 id) const noexcept;
+    [[nodiscard]] int count() const noexcept;
+    [[nodiscard]] int visibleCount() const noexcept;
+    [[nodiscard]] int queuedCount() const noexcept;
+
+    /**
+     * @brief 获取可见条目，按堆叠顺序排列。
+     * @return 可见条目列表。
+     */
+    [[nodiscard]] const std::deque<ToastEntry> &visible() const noexcept;
+
+    /**
+     * @brief 获取排队中的条目，按提交顺序排列。
+     * @return 排队中的条目列表。
+     */
+    [[nodiscard]] const std::deque<ToastEntry> &queued() const noexcept;
+
+private:
+    [[nodiscard]] bool hasRoom() const noexcept;
+    bool show(ToastEntry entry);
+    void relayoutFrom(size_t index);
+
+    ToastRenderer *m_renderer{nullptr};
+    int m_capacity{INT_MAX};
+    int m_spacing{0};
+    std::deque<ToastEntry> m_visible;
+    std::deque<ToastEntry> m_queue;
+};
@@ -0,0 +1,169 @@
+#include "ToastTimerWheel.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+constexpr qint64 levelSpan(int level) noexcept
+{
+    return qint64(1) << (ToastTimerWheel::LevelBits * level);
+}
+
+constexpr size_t slotIndex(qint64 tick, int level) noexcept
+{
+    return static_cast<size_t>(
+        (tick >> (ToastTimerWheel::LevelBits * level)) & (ToastTimerWheel::SlotCount - 1));
+}
+} // namespace
+
+ToastTimerWheel::ToastTimerWheel(qint64 resolution, qint64 now) noexcept
+    : m_resolution(std::max<qint64>(1, resolution))
+    , m_tick(std::max<qint64>(0, now) / m_resolution)
+{}
+
+qint64 ToastTimerWheel::resolution() const noexcept
+{
+    return m_resolution;
+}
+
+void ToastTimerWheel::add(quint64 id, qint64 deadline)
+{
+    // 向上取整，保证不会早于截止时间触发
+    const qint64 tick = deadline <= 0 ? 0 : (deadline + m_resolution - 1) / m_resolution;
+    auto [it, inserted] = m_deadlines.try_emplace(id, tick);
+    if (!inserted) {
+        if (it->second == tick) {
+            return;
+        }
+        // 旧记录留在槽中，经过时因刻度不一致而被跳过
+        it->second = tick;
+    }
+    place({id, tick});
+}
+
+bool ToastTimerWheel::cancel(quint64 id) noexcept
+{
+    return m_deadlines.erase(id) > 0;
+}
+
+bool ToastTimerWheel::contains(quint64 id) const noexcept
+{
+    return m_deadlines.find(id) != m_deadlines.end();
+}
+
+int ToastTimerWheel::size() const noexcept
+{
+    return static_cast<int>(m_deadlines.size());
+}
+
+void ToastTimerWheel::clear() noexcept
+{
+    for (auto &level : m_levels) {
+        for (auto &bucket : level) {
+            bucket.clear();
+        }
+    }
+    m_levelSizes.fill(0);
+    m_deadlines.clear();
+}
+
+qint64 ToastTimerWheel::nextDeadline() const noexcept
+{
+    if (m_deadlines.empty()) {
+        return -1;
+    }
+    qint64 next = std::numeric_limits<qint64>::max();
+    if (m_levelSizes[0] > 0) {
+        for (qint64 tick = m_tick; tick < m_tick + SlotCount; tick++) {
+            if (!m_levels[0][slotIndex(tick, 0)].empty()) {
+                next = tick;
+                break;
+            }
+        }
+    }
+    // 上层条目在所在块开始时下移，此时才能确定它们在第 0 层的位置
+    for (int level = 1; level < LevelCount; level++) {
+        if (m_levelSizes[static_cast<size_t>(level)] == 0) {
+            continue;
+        }
+        const int shift = LevelBits * level;
+        const qint64 first = (m_tick + levelSpan(level) - 1) >> shift;
+        for (qint64 block = first; block < first + SlotCount; block++) {
+            if (!m_levels[static_cast<size_t>(level)][slotIndex(block << shift, level)].empty()) {
+                next = std::min(next, block << shift);
+                break;
+            }
+        }
+    }
+    return (next == std::numeric_limits<qint64>::max() ? m_tick : next) * m_resolution;
+}
+
+std::vector<quint64> ToastTimerWheel::advance(qint64 now)
+{
+    std::vector<quint64> expired;
+    const qint64 target = std::max<qint64>(0, now) / m_resolution;
+    while (m_tick <= target) {
+        if (m_deadlines.empty()) {
+            // 只剩已取消的记录
+            clear();
+            m_tick = target + 1;
+            break;
+        }
+        // 先下移高层，高层下移的条目可能落入同一时刻需要下移的低层槽
+        for (int level = LevelCount - 1; level > 0; level--) {
+            if ((m_tick & (levelSpan(level) - 1)) == 0) {
+                cascade(level);
+            }
+        }
+        auto &bucket = m_levels[0][slotIndex(m_tick, 0)];
+        if (!bucket.empty()) {
+            m_levelSizes[0] -= static_cast<int>(bucket.size());
+            for (const Slot &slot : bucket) {
+                auto it = m_deadlines.find(slot.id);
+                if (it != m_deadlines.end() && it->second == slot.tick) {
+                    expired.push_back(slot.id);
+                    m_deadlines.erase(it);
+                }
+            }
+            bucket.clear();
+        }
+        m_tick++;
+        if (m_levelSizes[0] == 0) {
+            // 第 0 层为空时直接跳到下一个下移边界
+            const qint64 boundary = ((m_tick + SlotCount - 1) >> LevelBits) << LevelBits;
+            m_tick = std::min(target + 1, boundary);
+        }
+    }
+    return expired;
+}
+
+void ToastTimerWheel::place(const Slot &slot)
+{
+    const qint64 tick = std::max(slot.tick, m_tick);
+    const qint64 delta = tick - m_tick;
+    int level = 0;
+    while (level < LevelCount - 1 && delta >= levelSpan(level + 1)) {
+        level++;
+    }
+    // 超出顶层范围的条目先放在顶层最远的槽，下移时再按真实刻度放置
+    const qint64 span = levelSpan(LevelCount);
+    const qint64 placed = delta >= span ? m_tick + span - 1 : tick;
+    m_levels[static_cast<size_t>(level)][slotIndex(placed, level)].push_back(slot);
+    m_levelSizes[static_cast<size_t>(level)]++;
+}
+
+void ToastTimerWheel::cascade(int level)
+{
+    auto &bucket = m_levels[static_cast<size_t>(level)][slotIndex(m_tick, level)];
+    if (bucket.empty()) {
+        return;
+    }
+    std::vector<Slot> slots;
+    slots.swap(bucket);
+    m_levelSizes[static_cast<size_t>(level)] -= static_cast<int>(slots.size());
+    for (const Slot &slot : slots) {
+        auto it = m_deadlines.find(slot.id);
+        if (it != m_deadlines.end() && it->second == slot.tick) {
+            place(slot);
+        }
+    }
+}
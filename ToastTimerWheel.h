@@ -0,0 +1,97 @@
+#pragma once
+
+#include "ToastGlobal.h"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 分层时间轮：4 层、每层 64 个槽，按固定精度把截止时间映射到槽中。添加与取消均为 O(1)，
+ *        推进时只处理到期的槽，远期条目随时间逐层下移。不依赖事件循环，由调用方用单个定时器驱动：
+ *        每次唤醒调用 advance()，再按 nextDeadline() 安排下一次唤醒。
+ *        默认精度 100 毫秒时，第 0 层覆盖 6.4 秒，第 3 层覆盖约 19 天，更远的条目到达顶层后重新放置。
+ *
+ */
+class QTTOAST_EXPORT ToastTimerWheel final
+{
+public:
+    static constexpr int LevelBits = 6;
+    static constexpr int SlotCount = 1 << LevelBits;
+    static constexpr int LevelCount = 4;
+
+    /**
+     * @brief 构造时间轮。
+     * @param resolution 精度（毫秒），至少为 1。条目最多晚于截止时间一个精度触发，不会提前触发。
+     * @param now 当前时间（毫秒），与之后传入的时间使用同一个单调时钟。
+     */
+    explicit ToastTimerWheel(qint64 resolution = 100, qint64 now = 0) noexcept;
+
+    Q_DISABLE_COPY_MOVE(ToastTimerWheel)
+
+    /**
+     * @brief 获取精度。
+     * @return 精度（毫秒）。
+     */
+    [[nodiscard]] qint64 resolution() const noexcept;
+
+    /**
+     * @brief 添加条目。标识已存在时改为新的截止时间。
+     * @param id 条目的唯一标识。
+     * @param deadline 截止时间（毫秒），早于已推进到的时间时在下一个刻度触发。
+     */
+    void add(quint64 id, qint64 deadline);
+
+    /**
+     * @brief 取消条目。槽中的记录在经过时惰性清除。
+     * @param id 条目的唯一标识。
+     * @return 条目存在时返回 true。
+     */
+    bool cancel(quint64 id) noexcept;
+
+    /**
+     * @brief 查询条目是否仍在等待。
+     * @param id 条目的唯一标识。
+     * @return 等待中返回 true。
+     */
+    [[nodiscard]] bool contains(quint64 id) const noexcept;
+
+    /**
+     * @brief 获取等待中的条目数量。
+     * @return 条目数量。
+     */
+    [[nodiscard]] int size() const noexcept;
+
+    /**
+     * @brief 清空所有条目。
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 获取下一次需要调用 advance() 的时间：最近一个到期槽的时间，或者上层有条目需要下移的时间。
+     * @return 时间（毫秒）；没有条目时返回 -1。
+     */
+    [[nodiscard]] qint64 nextDeadline() const noexcept;
+
+    /**
+     * @brief 推进到 now，取出所有已到期的条目。
+     * @param now 当前时间（毫秒）。
+     * @return 到期条目的标识，按截止时间排序（同一精度内按添加顺序）。
+     */
+    [[nodiscard]] std::vector<quint64> advance(qint64 now);
+
+private:
+    struct Slot
+    {
+        quint64 id{0};
+        qint64 tick{0}; ///< 截止时间所在的刻度，与 m_deadlines 不一致时说明记录已失效
+    };
+
+    void place(const Slot &slot);
+    void cascade(int level);
+
+    qint64 m_resolution{100};
+    qint64 m_tick{0}; ///< 下一个待处理的刻度
+    std::array<std::array<std::vector<Slot>, SlotCount>, LevelCount> m_levels;
+    std::array<int, LevelCount> m_levelSizes{}; ///< 各层记录数（含已失效的记录）
+    std::unordered_map<quint64, qint64> m_deadlines; ///< 等待中条目的截止刻度
+};
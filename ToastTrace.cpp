@@ -0,0 +1,218 @@
+#include "ToastTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <QAbstractAnimation>
+#include <QCoreApplication>
+#include <QFile>
+#include <QThread>
+#if defined(Q_OS_LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(Q_OS_DARWIN)
+#include <pthread.h>
+#elif defined(Q_OS_WIN)
+#include <qt_windows.h>
+#endif
+
+namespace {
+bool s_traceEnabled = false;
+
+/**
+ * @brief 获取操作系统的线程标识，与 perf、ETW、Instruments 记录的 tid 相同，
+ *        导出的事件因此能和系统级追踪合并到同一条时间线上。
+ */
+quint64 currentThreadId() noexcept
+{
+#if defined(Q_OS_LINUX)
+    return static_cast<quint64>(::syscall(SYS_gettid));
+#elif defined(Q_OS_DARWIN)
+    uint64_t id = 0;
+    pthread_threadid_np(nullptr, &id);
+    return id;
+#elif defined(Q_OS_WIN)
+    return static_cast<quint64>(::GetCurrentThreadId());
+#else
+    // 没有可与系统追踪对应的整数标识，退回 Qt 的线程句柄
+    return static_cast<quint64>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+#endif
+}
+
+void appendEvent(QByteArray &json, const char *name, char phase, qint64 pid, quint64 tid)
+{
+    json += "{\"name\":\"";
+    json += name;
+    json += "\",\"cat\":\"qttoast\",\"ph\":\"";
+    json += phase;
+    json += "\",\"pid\":";
+    json += QByteArray::number(pid);
+    json += ",\"tid\":";
+    json += QByteArray::number(tid);
+}
+} // namespace
+
+ToastTracer &ToastTracer::instance() noexcept
+{
+    static ToastTracer s_instance;
+    return s_instance;
+}
+
+ToastTracer::ToastTracer() = default;
+
+bool ToastTracer::isEnabled() noexcept
+{
+    return s_traceEnabled;
+}
+
+ToastTracer &ToastTracer::setEnabled(bool enabled)
+{
+    if (enabled) {
+        // 预先分配整个缓冲区，记录时不再分配内存
+        m_events.reserve(m_capacity);
+        m_threadId = currentThreadId();
+    }
+    s_traceEnabled = enabled;
+    return *this;
+}
+
+int ToastTracer::capacity() const noexcept
+{
+    return static_cast<int>(m_capacity);
+}
+
+ToastTracer &ToastTracer::setCapacity(int capacity)
+{
+    m_capacity = static_cast<size_t>(std::max(1, capacity));
+    std::vector<Event>().swap(m_events);
+    m_next = 0;
+    if (s_traceEnabled) {
+        m_events.reserve(m_capacity);
+    }
+    return *this;
+}
+
+void ToastTracer::clear() noexcept
+{
+    m_events.clear();
+    m_next = 0;
+}
+
+int ToastTracer::size() const noexcept
+{
+    return static_cast<int>(m_events.size());
+}
+
+void ToastTracer::complete(const char *name, quint64 id, qint64 begin) noexcept
+{
+    if (s_traceEnabled) {
+        append({name, 'X', id, begin, now() - begin});
+    }
+}
+
+void ToastTracer::instant(const char *name, quint64 id) noexcept
+{
+    if (s_traceEnabled) {
+        append({name, 'i', id, now(), 0});
+    }
+}
+
+void ToastTracer::begin(const char *name, quint64 id) noexcept
+{
+    if (s_traceEnabled) {
+        append({name, 'b', id, now(), 0});
+    }
+}
+
+void ToastTracer::end(const char *name, quint64 id) noexcept
+{
+    if (s_traceEnabled) {
+        append({name, 'e', id, now(), 0});
+    }
+}
+
+void ToastTracer::traceAnimation(const char *name, quint64 id, QAbstractAnimation *animation)
+{
+    if (!s_traceEnabled || animation == nullptr) {
+        return;
+    }
+    begin(name, id);
+    QObject::connect(animation, &QAbstractAnimation::finished, [name, id]() {
+        ToastTracer::instance().end(name, id);
+    });
+}
+
+QByteArray ToastTracer::toJson() const
+{
+    const qint64 pid = QCoreApplication::applicationPid();
+    QByteArray json;
+    json.reserve(static_cast<int>(m_events.size()) * 128 + 64);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto write = [&](const Event &event) {
+        if (!first) {
+            json += ',';
+        }
+        first = false;
+        appendEvent(json, event.name, event.phase, pid, m_threadId);
+        json += ",\"ts\":";
+        json += QByteArray::number(event.timestamp);
+        if (event.phase == 'X') {
+            json += ",\"dur\":";
+            json += QByteArray::number(event.duration);
+        } else if (event.phase == 'i') {
+            json += ",\"s\":\"t\"";
+        } else {
+            json += ",\"id\":";
+            json += QByteArray::number(event.id);
+        }
+        json += ",\"args\":{\"toast\":";
+        json += QByteArray::number(event.id);
+        json += "}}";
+    };
+    // 缓冲区写满后 m_next 指向最旧的事件
+    const size_t count = m_events.size();
+    const size_t oldest = count < m_capacity ? 0 : m_next;
+    for (size_t i = 0; i < count; i++) {
+        write(m_events[(oldest + i) % count]);
+    }
+    json += "]}";
+    return json;
+}
+
+bool ToastTracer::dump(const QString &path) const
+{
+    QFile file(path);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+    return file.write(toJson()) >= 0;
+}
+
+qint64 ToastTracer::now() noexcept
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void ToastTracer::append(const Event &event) noexcept
+{
+    if (m_events.size() < m_capacity) {
+        m_events.push_back(event);
+        m_next = m_events.size() % m_capacity;
+        return;
+    }
+    m_events[m_next] = event;
+    m_next = (m_next + 1) % m_capacity;
+}
+
+ToastTraceScope::ToastTraceScope(const char *name, quint64 id) noexcept
+    : m_name(ToastTracer::isEnabled() ? name : nullptr)
+    , m_id(id)
+    , m_begin(m_name != nullptr ? ToastTracer::now() : 0)
+{}
+
+ToastTraceScope::~ToastTraceScope()
+{
+    if (m_name != nullptr) {
+        ToastTracer::instance().complete(m_name, m_id, m_begin);
+    }
+}
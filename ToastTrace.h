@@ -0,0 +1,156 @@
+#pragma once
+
+#include "ToastGlobal.h"
+#include <vector>
+#include <QByteArray>
+#include <QString>
+
+class QAbstractAnimation;
+
+/**
+ * @brief Toast 生命周期追踪器：将各阶段记录为 Chrome trace-event 事件，保存在固定容量的环形缓冲区中，
+ *        按需导出为 JSON，可在 Perfetto 或 chrome://tracing 中与应用自身的追踪数据一同查看。
+ *        默认关闭，关闭时每个埋点只有一次布尔判断。只应在 GUI 线程中使用。
+ *
+ */
+class QTTOAST_EXPORT ToastTracer final
+{
+public:
+    static constexpr int DefaultCapacity = 8192;
+
+    static ToastTracer &instance() noexcept;
+
+    Q_DISABLE_COPY_MOVE(ToastTracer)
+
+    /**
+     * @brief 查询是否正在记录。
+     * @return 记录中返回 true。
+     */
+    [[nodiscard]] static bool isEnabled() noexcept;
+
+    /**
+     * @brief 开始或停止记录。停止后已记录的事件仍保留，直到调用 clear()。
+     * @param enabled 是否记录。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastTracer &setEnabled(bool enabled);
+
+    /**
+     * @brief 获取环形缓冲区的容量。
+     * @return 最多保留的事件数量。
+     */
+    [[nodiscard]] int capacity() const noexcept;
+
+    /**
+     * @brief 设置环形缓冲区的容量，并清空已记录的事件。
+     * @param capacity 最多保留的事件数量，至少为 1。
+     * @return 当前对象的引用，支持链式调用。
+     */
+    ToastTracer &setCapacity(int capacity);
+
+    /**
+     * @brief 清空已记录的事件。
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 获取当前缓冲区中的事件数量。
+     * @return 事件数量。
+     */
+    [[nodiscard]] int size() const noexcept;
+
+    /**
+     * @brief 记录一个从 begin 持续到现在的同步阶段（"X" 事件）。
+     * @param name 阶段名称，必须是静态字符串。
+     * @param id Toast 的唯一标识。
+     * @param begin 开始时间（now()）。
+     */
+    void complete(const char *name, quint64 id, qint64 begin) noexcept;
+
+    /**
+     * @brief 记录一个瞬时事件（"i" 事件）。
+     * @param name 事件名称，必须是静态字符串。
+     * @param id Toast 的唯一标识。
+     */
+    void instant(const char *name, quint64 id) noexcept;
+
+    /**
+     * @brief 开始一个跨越事件循环的异步阶段（"b" 事件），例如排队或动画。
+     * @param name 阶段名称，必须是静态字符串。
+     * @param id Toast 的唯一标识，与 end() 配对。
+     */
+    void begin(const char *name, quint64 id) noexcept;
+
+    /**
+     * @brief 结束一个异步阶段（"e" 事件）。
+     * @param name 阶段名称，必须与 begin() 相同。
+     * @param id Toast 的唯一标识。
+     */
+    void end(const char *name, quint64 id) noexcept;
+
+    /**
+     * @brief 将动画的运行时间记录为异步阶段，动画结束时自动调用 end()。未在记录时不做任何事。
+     * @param name 阶段名称，必须是静态字符串。
+     * @param id Toast 的唯一标识。
+     * @param animation 即将启动的动画。
+     */
+    void traceAnimation(const char *name, quint64 id, QAbstractAnimation *animation);
+
+    /**
+     * @brief 将缓冲区中的事件按时间顺序导出为 Chrome trace-event JSON。
+     * @return JSON 文本。
+     */
+    [[nodiscard]] QByteArray toJson() const;
+
+    /**
+     * @brief 将 toJson() 的结果写入文件。
+     * @param path 文件路径。
+     * @return 写入成功返回 true。
+     */
+    bool dump(const QString &path) const;
+
+    /**
+     * @brief 获取追踪时钟的当前时间。使用系统单调时钟，便于与其他追踪数据对齐。
+     * @return 时间戳（微秒）。
+     */
+    [[nodiscard]] static qint64 now() noexcept;
+
+private:
+    /**
+     * @brief 缓冲区中的一个事件。名称指向静态字符串，记录时不分配内存。
+     */
+    struct Event
+    {
+        const char *name{nullptr};
+        char phase{0};
+        quint64 id{0};
+        qint64 timestamp{0};
+        qint64 duration{0};
+    };
+
+    explicit ToastTracer();
+    void append(const Event &event) noexcept;
+
+    std::vector<Event> m_events;
+    size_t m_capacity{DefaultCapacity};
+    size_t m_next{0};
+    quint64 m_threadId{0};
+};
+
+/**
+ * @brief 在作用域结束时记录一个同步阶段。未在记录时只有一次布尔判断。
+ *
+ */
+class QTTOAST_EXPORT ToastTraceScope final
+{
+public:
+    ToastTraceScope(const char *name, quint64 id) noexcept;
+    ~ToastTraceScope();
+
+    Q_DISABLE_COPY_MOVE(ToastTraceScope)
+
+private:
+    const char *m_name{nullptr};
+    quint64 m_id{0};
+    qint64 m_begin{0};
+};
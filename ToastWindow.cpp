@@ -1,10 +1,14 @@
 #include "ToastWindow.h"
 #include "Toast.h"
+#include <QApplication>
+#include <QFontDatabase>
+#include <QPaintEvent>
+#include <QPainter>
 
 ToastWindow::ToastWindow(QWidget *parent)
 {
     // Window settings
-    setFixedSize(650, 360);
+    setFixedSize(650, 465);
     setWindowTitle("Qt Toast Demo");
 
     // Create main layout
@@ -12,6 +16,7 @@ ToastWindow::ToastWindow(QWidget *parent)
     m_gridLayout->addWidget(createStaticSettingsGroup(), 0, 0);
     m_gridLayout->addWidget(createToastPresetGroup(), 1, 0);
     m_gridLayout->addWidget(createToastCustomGroup(), 0, 1, 2, 1, Qt::AlignmentFlag::AlignTop);
+    m_gridLayout->addWidget(createDiagnosticsGroup(), 2, 0, 1, 2);
 
     // Set layout
     m_centralWidget = new QWidget();
@@ -52,6 +57,69 @@ void ToastWindow::updateStaticSettings()
     ToastManager::instance().updateAllPositions();
 }
 
+void ToastWindow::setFrameMonitorEnabled(bool enabled)
+{
+    auto &metrics = ToastManager::instance().metrics();
+    metrics.setFrameMonitorEnabled(enabled);
+    metrics.setReportInterval(enabled ? 500 : 0);
+    m_metricsLabel->setVisible(enabled);
+    if (enabled) {
+        updateMetricsLabel(metrics.snapshot());
+    }
+}
+
+void ToastWindow::updateMetricsLabel(const ToastMetricsSnapshot &snapshot)
+{
+    const auto frameTime = [](const ToastHistogram &histogram) {
+        return QString("%1 frames, p50 %2 ms, p95 %3 ms, max %4 ms")
+            .arg(histogram.count())
+            .arg(histogram.percentile(0.5) / 1000.0, 0, 'f', 1)
+            .arg(histogram.percentile(0.95) / 1000.0, 0, 'f', 1)
+            .arg(histogram.max() / 1000.0, 0, 'f', 1);
+    };
+    m_metricsLabel->setText(
+        QString("Toast animations: %1\nReflow animations: %2\nDropped frames: %3 of %4")
+            .arg(frameTime(snapshot.toastFrameTime))
+            .arg(frameTime(snapshot.reflowFrameTime))
+            .arg(snapshot.droppedFrames)
+            .arg(snapshot.frames));
+}
+
+void ToastWindow::setRepaintFlashEnabled(bool enabled)
+{
+    if (enabled) {
+        qApp->installEventFilter(this);
+    } else {
+        qApp->removeEventFilter(this);
+    }
+}
+
+bool ToastWindow::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() != QEvent::Paint || !watched->isWidgetType()) {
+        return QMainWindow::eventFilter(watched, event);
+    }
+    auto *widget = static_cast<QWidget *>(watched);
+    bool insideToast = false;
+    for (QWidget *ancestor = widget; ancestor != nullptr; ancestor = ancestor->parentWidget()) {
+        if (qobject_cast<Toast *>(ancestor) != nullptr) {
+            insideToast = true;
+            break;
+        }
+    }
+    if (!insideToast) {
+        return QMainWindow::eventFilter(watched, event);
+    }
+    // 先让控件正常绘制，再给本次重绘的区域叠加一层颜色。每次重绘换一种颜色，
+    // 不变的内容保持原来的颜色，持续变色的区域就是被反复重绘的区域
+    static_cast<QObject *>(widget)->event(event);
+    QPainter painter(widget);
+    painter.setClipRegion(static_cast<QPaintEvent *>(event)->region());
+    painter.fillRect(widget->rect(), QColor::fromHsv(m_repaintFlashHue, 255, 255, 96));
+    m_repaintFlashHue = (m_repaintFlashHue + 47) % 360;
+    return true;
+}
+
 void ToastWindow::showPresetToast()
 {
     auto *toast = new Toast(this);
@@ -391,3 +459,39 @@ QGroupBox *ToastWindow::createToastCustomGroup()
 
     return groupBox;
 }
+
+QGroupBox *ToastWindow::createDiagnosticsGroup()
+{
+    QGroupBox *groupBox = new QGroupBox("Diagnostics");
+
+    m_frameMonitorCheckbox = new QCheckBox("Monitor animation frame times");
+    connect(
+        m_frameMonitorCheckbox,
+        &QCheckBox::toggled,
+        this,
+        &ToastWindow::setFrameMonitorEnabled);
+
+    m_metricsLabel = new QLabel();
+    m_metricsLabel->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    m_metricsLabel->setVisible(false);
+    connect(
+        &ToastManager::instance().metrics(),
+        &ToastMetrics::reported,
+        this,
+        &ToastWindow::updateMetricsLabel);
+
+    m_repaintFlashCheckbox = new QCheckBox("Flash toast repaint regions");
+    connect(
+        m_repaintFlashCheckbox,
+        &QCheckBox::toggled,
+        this,
+        &ToastWindow::setRepaintFlashEnabled);
+
+    QVBoxLayout *vboxLayout = new QVBoxLayout();
+    vboxLayout->addWidget(m_frameMonitorCheckbox);
+    vboxLayout->addWidget(m_metricsLabel);
+    vboxLayout->addWidget(m_repaintFlashCheckbox);
+    groupBox->setLayout(vboxLayout);
+
+    return groupBox;
+}
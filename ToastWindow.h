@@ -11,6 +11,8 @@
 #include <QPushButton>
 #include <QSpinBox>
 
+struct ToastMetricsSnapshot;
+
 class ToastWindow : public QMainWindow
 {
     Q_OBJECT
@@ -19,10 +21,16 @@ public:
     ToastWindow(QWidget *parent = nullptr);
     ~ToastWindow();
 
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
     void updateStaticSettings();
     void showPresetToast();
     void showCustomToast();
+    void setFrameMonitorEnabled(bool enabled);
+    void updateMetricsLabel(const ToastMetricsSnapshot &snapshot);
+    void setRepaintFlashEnabled(bool enabled);
 
 private:
     QGridLayout *m_gridLayout;
@@ -53,8 +61,13 @@ private:
     QSpinBox *m_fadeInDurationSpinbox;
     QSpinBox *m_fadeOutDurationSpinbox;
     QPushButton *m_customToastButton;
+    QCheckBox *m_frameMonitorCheckbox;
+    QLabel *m_metricsLabel;
+    QCheckBox *m_repaintFlashCheckbox;
+    int m_repaintFlashHue = 0;
 
     QGroupBox *createStaticSettingsGroup();
     QGroupBox *createToastPresetGroup();
     QGroupBox *createToastCustomGroup();
+    QGroupBox *createDiagnosticsGroup();
 };
@@ -0,0 +1,779 @@
+#include "Toast.h"
+#include "ToastScheduler.h"
+#include "ToastTimerWheel.h"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFutureInterface>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPlainTextEdit>
+#include <QTextStream>
+
+namespace {
+constexpr int EventTimeout = 30000;
+constexpr qint64 LayoutBudget = 50 * 1000 * 1000; ///< 超长文本单次布局的上限（纳秒）
+
+/**
+ * @brief 只计数的渲染器，用于在没有任何控件的情况下测量调度核心。
+ */
+class CountingRenderer final : public ToastRenderer
+{
+public:
+    bool showEntry(const ToastEntry &entry) override
+    {
+        Q_UNUSED(entry)
+        shown++;
+        return true;
+    }
+
+    void moveEntry(const ToastEntry &entry, int offsetY) override
+    {
+        Q_UNUSED(entry)
+        Q_UNUSED(offsetY)
+        moved++;
+    }
+
+    void dropEntry(quint64 id) override
+    {
+        Q_UNUSED(id)
+        dropped++;
+    }
+
+    quint64 shown{0};
+    quint64 moved{0};
+    quint64 dropped{0};
+};
+
+/**
+ * @brief 统计目标控件收到的绘制事件数量。
+ */
+class PaintCounter final : public QObject
+{
+public:
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        Q_UNUSED(watched)
+        if (event->type() == QEvent::Paint) {
+            painted++;
+        }
+        return false;
+    }
+
+    quint64 painted{0};
+};
+
+void flushDeferredDeletes()
+{
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+bool processEventsUntil(const std::function<bool()> &done)
+{
+    QElapsedTimer timeout;
+    timeout.start();
+    while (!done()) {
+        if (timeout.elapsed() > EventTimeout) {
+            return false;
+        }
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+    }
+    return true;
+}
+
+ToastConfig benchmarkConfig()
+{
+    ToastConfig config;
+    config.setPreset(ToastPreset::Information)
+        .setTitle(QStringLiteral("Benchmark toast"))
+        .setText(QStringLiteral("The quick brown fox jumps over the lazy dog."))
+        .setDuration(0)
+        .setFadeInDuration(0)
+        .setFadeOutDuration(0);
+    return config;
+}
+} // namespace
+
+/**
+ * @brief 离屏基准测试：逐一测量 Toast 生命周期的各个阶段，并以 JSON 输出结果，便于对比两次构建。
+ *        作为 Toast 的友元直接调用各阶段的私有实现。
+ *
+ */
+class ToastBenchmark final
+{
+public:
+    explicit ToastBenchmark(int iterations, int schedulerOperations)
+        : m_iterations(std::max(1, iterations))
+        , m_schedulerOperations(std::max(1, schedulerOperations))
+    {}
+
+    void run()
+    {
+        // Auto 在 offscreen 平台上会选择 Opaque；固定为桌面默认路径，使结果与平台检测无关
+        ToastGlobalConfig::instance()
+            .setPerformanceProfile(ToastPerformanceProfile::Full)
+            .setRenderMode(ToastRenderMode::Translucent);
+        benchConstruction();
+        benchUpdateConfig();
+        benchSetupDefaultContent();
+        benchPathologicalText();
+        benchFullTextViewer();
+        benchCalculatePosition();
+        benchRecolorImage();
+        benchFlyIn();
+        benchPolish(ToastStyleMode::StyleSheet, QStringLiteral("polish.stylesheet"));
+        benchPolish(ToastStyleMode::Palette, QStringLiteral("polish.palette"));
+        benchRender(ToastRenderMode::Translucent, QStringLiteral("render.translucent"));
+        benchRender(ToastRenderMode::Opaque, QStringLiteral("render.opaque"));
+        for (int count : {1, 10, 100, 1000}) {
+            benchCycle(count);
+        }
+        benchProgress();
+        benchLogTail();
+        benchScheduler();
+        benchTimerWheel();
+        checkTimerWheel();
+    }
+
+    /**
+     * @brief 查询是否有阶段超出了其耗时上限。
+     * @return 超出时返回 true。
+     */
+    [[nodiscard]] bool budgetExceeded() const noexcept
+    {
+        return m_budgetExceeded;
+    }
+
+    /**
+     * @brief 查询是否有正确性检查失败。
+     * @return 失败时返回 true。
+     */
+    [[nodiscard]] bool checksFailed() const noexcept
+    {
+        return m_checksFailed;
+    }
+
+    [[nodiscard]] QJsonDocument report() const
+    {
+        QJsonObject root;
+        root.insert(QStringLiteral("qtVersion"), QString::fromLatin1(qVersion()));
+        root.insert(QStringLiteral("platform"), QGuiApplication::platformName());
+        root.insert(
+            QStringLiteral("timestamp"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+        root.insert(QStringLiteral("results"), m_results);
+        return QJsonDocument(root);
+    }
+
+private:
+    /**
+     * @brief 重复执行一个阶段并记录每次的耗时。
+     * @param name 阶段名称。
+     * @param iterations 重复次数。
+     * @param body 执行一次阶段，返回被测部分的耗时（纳秒），
+     *             准备与清理不计入。
+     */
+    void measure(const QString &name, int iterations, const std::function<qint64()> &body)
+    {
+        std::vector<qint64> samples;
+        samples.reserve(static_cast<size_t>(iterations));
+        for (int i = 0; i < iterations; i++) {
+            samples.push_back(body());
+        }
+        record(name, std::move(samples));
+    }
+
+    void record(const QString &name, std::vector<qint64> samples)
+    {
+        if (samples.empty()) {
+            return;
+        }
+        std::sort(samples.begin(), samples.end());
+        const auto at = [&samples](double quantile) {
+            const double last = static_cast<double>(samples.size() - 1);
+            return samples.at(static_cast<size_t>(quantile * last));
+        };
+        const double sum = std::accumulate(samples.begin(), samples.end(), 0.0);
+        QJsonObject result;
+        result.insert(QStringLiteral("name"), name);
+        result.insert(QStringLiteral("iterations"), static_cast<qint64>(samples.size()));
+        result.insert(QStringLiteral("unit"), QStringLiteral("ns"));
+        result.insert(QStringLiteral("min"), samples.front());
+        result.insert(QStringLiteral("median"), at(0.5));
+        result.insert(QStringLiteral("mean"), sum / static_cast<double>(samples.size()));
+        result.insert(QStringLiteral("p95"), at(0.95));
+        result.insert(QStringLiteral("max"), samples.back());
+        m_results.append(result);
+    }
+
+    static std::unique_ptr<Toast> createToast()
+    {
+        auto toast = std::make_unique<Toast>(nullptr);
+        toast->setConfig(benchmarkConfig());
+        return toast;
+    }
+
+    void benchConstruction()
+    {
+        measure(QStringLiteral("toast.construction"), m_iterations, []() {
+            QElapsedTimer timer;
+            timer.start();
+            auto *toast = new Toast(nullptr);
+            const qint64 elapsed = timer.nsecsElapsed();
+            delete toast;
+            return elapsed;
+        });
+    }
+
+    void benchUpdateConfig()
+    {
+        measure(QStringLiteral("toast.updateConfig"), m_iterations, []() {
+            auto toast = createToast();
+            QElapsedTimer timer;
+            timer.start();
+            toast->updateConfig();
+            return timer.nsecsElapsed();
+        });
+    }
+
+    void benchSetupDefaultContent()
+    {
+        measure(QStringLiteral("toast.setupDefaultContent"), m_iterations, []() {
+            auto toast = createToast();
+            toast->updateConfig();
+            QElapsedTimer timer;
+            timer.start();
+            toast->setupDefaultContent();
+            return timer.nsecsElapsed();
+        });
+    }
+
+    void benchPathologicalText()
+    {
+        // 数 MB 的异常堆栈：无换行的单行与大量短行两种形态，布局耗时应与输入大小无关
+        const QString frame = QStringLiteral("    at com.example.Handler.run(Handler.java:1)\n");
+        const int iterations = std::min(m_iterations, 10);
+        for (int megabytes : {2, 8}) {
+            const int length = megabytes * 1024 * 1024;
+            const std::pair<QString, QString> inputs[] = {
+                {QStringLiteral("singleLine"), QString(length, QLatin1Char('x'))},
+                {QStringLiteral("multiLine"), frame.repeated(length / frame.size())},
+            };
+            for (const auto &input : inputs) {
+                const QString &text = input.second;
+                const QString name =
+                    QStringLiteral("layout.%1.%2mb").arg(input.first).arg(megabytes);
+                qint64 slowest = 0;
+                measure(name, iterations, [&text, &slowest]() {
+                    auto toast = createToast();
+                    toast->config().setText(text);
+                    QElapsedTimer timer;
+                    timer.start();
+                    toast->setupDefaultContent();
+                    const qint64 elapsed = timer.nsecsElapsed();
+                    slowest = std::max(slowest, elapsed);
+                    return elapsed;
+                });
+                if (slowest > LayoutBudget) {
+                    qWarning() << "Layout stage" << name << "exceeded its budget:" << slowest
+                               << "ns";
+                    m_budgetExceeded = true;
+                }
+            }
+        }
+    }
+
+    void benchFullTextViewer()
+    {
+        // 点击被截断的 2 MB 单行文本：打开全文窗口并处理到首次绘制完成
+        const QString text(2 * 1024 * 1024, QLatin1Char('x'));
+        const QString name = QStringLiteral("viewer.singleLine.2mb");
+        const int iterations = std::min(m_iterations, 10);
+        qint64 slowest = 0;
+        measure(name, iterations, [&text, &slowest]() {
+            auto toast = createToast();
+            toast->config().setText(text);
+            QElapsedTimer timer;
+            timer.start();
+            toast->showFullText();
+            QCoreApplication::processEvents();
+            const qint64 elapsed = timer.nsecsElapsed();
+            slowest = std::max(slowest, elapsed);
+            for (QWidget *widget : QApplication::topLevelWidgets()) {
+                if (qobject_cast<QPlainTextEdit *>(widget) != nullptr) {
+                    widget->close();
+                }
+            }
+            flushDeferredDeletes();
+            return elapsed;
+        });
+        if (slowest > LayoutBudget) {
+            qWarning() << "Viewer stage" << name << "exceeded its budget:" << slowest << "ns";
+            m_budgetExceeded = true;
+        }
+    }
+
+    void benchCalculatePosition()
+    {
+        auto toast = createToast();
+        toast->updateConfig();
+        toast->setupDefaultContent();
+        measure(QStringLiteral("toast.calculatePosition"), m_iterations, [&toast]() {
+            QElapsedTimer timer;
+            timer.start();
+            const QPoint position = toast->calculatePosition();
+            const qint64 elapsed = timer.nsecsElapsed();
+            Q_UNUSED(position)
+            return elapsed;
+        });
+    }
+
+    void benchRecolorImage()
+    {
+        const QImage image = ToastConfig::getIconFromEnum(ToastIcon::Success).toImage();
+        const QColor color = ToastGlobalConfig::SuccessAccentColor;
+        measure(QStringLiteral("config.recolorImage"), m_iterations, [&image, &color]() {
+            QElapsedTimer timer;
+            timer.start();
+            const QImage recolored = ToastConfig::recolorImage(image, color);
+            const qint64 elapsed = timer.nsecsElapsed();
+            Q_UNUSED(recolored)
+            return elapsed;
+        });
+    }
+
+    void benchFlyIn()
+    {
+        // 屏幕上已有一个 Toast 时才会执行带动画的飞入分支
+        measure(QStringLiteral("toast.flyIn"), m_iterations, []() {
+            auto &manager = ToastManager::instance();
+            Toast *first = createToast().release();
+            Toast *second = createToast().release();
+            manager.present(first).present(second);
+            QElapsedTimer timer;
+            timer.start();
+            second->flyIn();
+            const qint64 elapsed = timer.nsecsElapsed();
+            manager.reset();
+            flushDeferredDeletes();
+            return elapsed;
+        });
+    }
+
+    void benchPolish(ToastStyleMode mode, const QString &name)
+    {
+        ToastGlobalConfig::instance().setStyleMode(mode);
+        measure(name, m_iterations, []() {
+            QElapsedTimer timer;
+            timer.start();
+            auto toast = createToast();
+            toast->updateConfig();
+            toast->setupDefaultContent();
+            toast->ensurePolished();
+            const auto children = toast->findChildren<QWidget *>();
+            for (auto *child : children) {
+                child->ensurePolished();
+            }
+            return timer.nsecsElapsed();
+        });
+        ToastManager::instance().reset();
+    }
+
+    void benchRender(ToastRenderMode mode, const QString &name)
+    {
+        // 同步重绘一个已显示的 Toast：半透明路径包括不透明度效果的离屏渲染与 alpha 混合
+        auto &manager = ToastManager::instance();
+        manager.reset();
+        ToastGlobalConfig::instance().setRenderMode(mode);
+        Toast *toast = createToast().release();
+        manager.present(toast);
+        if (!processEventsUntil([&manager]() { return manager.visibleCount() == 1; })) {
+            qWarning() << "Render stage" << name << "timed out";
+            manager.reset();
+            ToastGlobalConfig::instance().setRenderMode(ToastRenderMode::Translucent);
+            return;
+        }
+        measure(name, m_iterations, [toast]() {
+            QElapsedTimer timer;
+            timer.start();
+            toast->repaint();
+            return timer.nsecsElapsed();
+        });
+        manager.reset();
+        flushDeferredDeletes();
+        ToastGlobalConfig::instance().setRenderMode(ToastRenderMode::Translucent);
+    }
+
+    void benchProgress()
+    {
+        // 一次性报告大量进度，统计进度条实际收到的绘制次数与任务结束后原地切换的耗时
+        constexpr int Updates = 10000;
+        auto &manager = ToastManager::instance();
+        manager.reset();
+        QFutureInterface<void> task;
+        task.reportStarted();
+        task.setProgressRange(0, Updates);
+        ToastDescriptor descriptor;
+        descriptor.config = benchmarkConfig();
+        const ToastHandle handle = manager.track(task.future(), std::move(descriptor));
+        if (!processEventsUntil([&manager]() { return manager.visibleCount() == 1; })) {
+            qWarning() << "Progress stage timed out";
+            task.reportFinished();
+            manager.reset();
+            return;
+        }
+        Toast *toast = handle.toast();
+        PaintCounter counter;
+        toast->m_durationBarChunk->installEventFilter(&counter);
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int value = 1; value <= Updates; value++) {
+            task.setProgressValue(value);
+            QCoreApplication::processEvents();
+        }
+        const qint64 reported = timer.nsecsElapsed();
+        timer.restart();
+        task.reportFinished();
+        processEventsUntil([&manager]() { return manager.trackedCount() == 0; });
+        const qint64 settled = timer.nsecsElapsed();
+        toast->m_durationBarChunk->removeEventFilter(&counter);
+
+        QJsonObject result;
+        result.insert(QStringLiteral("name"), QStringLiteral("progress.flood"));
+        result.insert(QStringLiteral("iterations"), Updates);
+        result.insert(QStringLiteral("unit"), QStringLiteral("ns"));
+        result.insert(
+            QStringLiteral("mean"), static_cast<double>(reported) / static_cast<double>(Updates));
+        result.insert(QStringLiteral("total"), reported);
+        result.insert(QStringLiteral("settle"), settled);
+        result.insert(QStringLiteral("chunkPaints"), static_cast<qint64>(counter.painted));
+        m_results.append(result);
+        manager.reset();
+        flushDeferredDeletes();
+    }
+
+    void benchLogTail()
+    {
+        // 向显示中的 Toast 持续追加日志：每次更新的耗时应与已追加的总行数无关
+        constexpr int Lines = 1000;
+        auto &manager = ToastManager::instance();
+        manager.reset();
+        Toast *toast = createToast().release();
+        manager.present(toast);
+        if (!processEventsUntil([&manager]() { return manager.visibleCount() == 1; })) {
+            qWarning() << "Log tail stage timed out";
+            manager.reset();
+            return;
+        }
+        int line = 0;
+        measure(QStringLiteral("log.appendLine"), Lines, [toast, &line]() {
+            QElapsedTimer timer;
+            timer.start();
+            toast->appendLine(QStringLiteral("[%1] Compiling translation unit %1 of %2")
+                                  .arg(++line)
+                                  .arg(Lines));
+            toast->flushLog();
+            return timer.nsecsElapsed();
+        });
+        manager.reset();
+        flushDeferredDeletes();
+    }
+
+    void benchCycle(int count)
+    {
+        const int repetitions = std::max(1, 100 / count);
+        std::vector<qint64> presentSamples;
+        std::vector<qint64> completeSamples;
+        std::vector<qint64> totalSamples;
+        auto &manager = ToastManager::instance();
+        for (int repetition = 0; repetition < repetitions; repetition++) {
+            manager.reset();
+            ToastGlobalConfig::instance().setMaximumOnScreen(count);
+            std::vector<ToastHandle> handles;
+            handles.reserve(static_cast<size_t>(count));
+
+            QElapsedTimer timer;
+            timer.start();
+            for (int i = 0; i < count; i++) {
+                ToastDescriptor descriptor;
+                descriptor.config = benchmarkConfig();
+                handles.push_back(manager.present(std::move(descriptor)));
+            }
+            const bool visible = processEventsUntil([&manager, count]() {
+                return manager.visibleCount() == count;
+            });
+            QCoreApplication::processEvents();
+            const qint64 presented = timer.nsecsElapsed();
+
+            for (const auto &handle : handles) {
+                handle.close();
+            }
+            const bool completed = processEventsUntil([&manager]() {
+                return manager.count() == 0;
+            });
+            flushDeferredDeletes();
+            const qint64 total = timer.nsecsElapsed();
+            if (!visible || !completed) {
+                qWarning() << "Cycle with" << count << "toasts timed out";
+                continue;
+            }
+            presentSamples.push_back(presented);
+            completeSamples.push_back(total - presented);
+            totalSamples.push_back(total);
+        }
+        const QString prefix = QStringLiteral("cycle.%1.").arg(count);
+        record(prefix + QStringLiteral("presentToVisible"), std::move(presentSamples));
+        record(prefix + QStringLiteral("complete"), std::move(completeSamples));
+        record(prefix + QStringLiteral("total"), std::move(totalSamples));
+        manager.reset();
+    }
+
+    void benchScheduler()
+    {
+        // 单次计时开销与被测操作同一量级，因此整体计时后取平均
+        CountingRenderer renderer;
+        ToastScheduler scheduler(&renderer);
+        scheduler.setCapacity(3).setSpacing(10);
+        constexpr int Backlog = 16;
+        const QSize size(320, 80);
+
+        QElapsedTimer timer;
+        timer.start();
+        for (quint64 id = 1; id <= static_cast<quint64>(m_schedulerOperations); id++) {
+            scheduler.present({id, size, 5000});
+            if (scheduler.queuedCount() > Backlog) {
+                scheduler.complete(scheduler.visible().front().id);
+                scheduler.promoteNext();
+            }
+        }
+        const qint64 elapsed = timer.nsecsElapsed();
+
+        QJsonObject result;
+        result.insert(QStringLiteral("name"), QStringLiteral("scheduler.presentComplete"));
+        result.insert(QStringLiteral("iterations"), m_schedulerOperations);
+        result.insert(QStringLiteral("unit"), QStringLiteral("ns"));
+        result.insert(
+            QStringLiteral("mean"),
+            static_cast<double>(elapsed) / static_cast<double>(m_schedulerOperations));
+        result.insert(QStringLiteral("total"), elapsed);
+        result.insert(QStringLiteral("shown"), static_cast<qint64>(renderer.shown));
+        result.insert(QStringLiteral("moved"), static_cast<qint64>(renderer.moved));
+        m_results.append(result);
+    }
+
+    void benchTimerWheel()
+    {
+        // 在半小时内均匀分布的截止时间，按 1 秒步长推进直到全部触发
+        constexpr qint64 Horizon = 30 * 60 * 1000;
+        const qint64 count = m_schedulerOperations;
+        ToastTimerWheel wheel;
+
+        QElapsedTimer timer;
+        timer.start();
+        for (quint64 id = 1; id <= static_cast<quint64>(count); id++) {
+            wheel.add(id, static_cast<qint64>(id) * 7919 % Horizon);
+        }
+        const qint64 added = timer.nsecsElapsed();
+        qint64 fired = 0;
+        for (qint64 now = 0; now <= Horizon; now += 1000) {
+            fired += static_cast<qint64>(wheel.advance(now).size());
+        }
+        const qint64 total = timer.nsecsElapsed();
+
+        QJsonObject result;
+        result.insert(QStringLiteral("name"), QStringLiteral("timerWheel.addAdvance"));
+        result.insert(QStringLiteral("iterations"), count);
+        result.insert(QStringLiteral("unit"), QStringLiteral("ns"));
+        result.insert(
+            QStringLiteral("mean"), static_cast<double>(total) / static_cast<double>(count));
+        result.insert(
+            QStringLiteral("addMean"), static_cast<double>(added) / static_cast<double>(count));
+        result.insert(QStringLiteral("total"), total);
+        result.insert(QStringLiteral("fired"), fired);
+        m_results.append(result);
+    }
+
+    void checkTimerWheel()
+    {
+        // 随机添加、重设、取消与推进，每一步都与按到期刻度排序的参考实现对比：
+        // 不早于截止时间触发，到期刻度一过必须触发，同一次推进中按到期刻度有序
+        constexpr qint64 Resolution = 100;
+        constexpr qint64 Day = 24 * 60 * 60 * 1000;
+        // 过去、第 0 层、上层以及超出顶层范围（约 19 天）的截止时间
+        constexpr std::array<qint64, 4> Horizons = {0, 6400, 60 * 60 * 1000, 40 * Day};
+        const int operations = std::min(m_schedulerOperations, 200000);
+        std::mt19937_64 random(20240601); // 固定种子，失败时可以复现
+        const auto uniform = [&random](qint64 low, qint64 high) {
+            return std::uniform_int_distribution<qint64>(low, high)(random);
+        };
+
+        struct Pending
+        {
+            qint64 deadline{0};
+            qint64 dueTick{0}; ///< 时间轮处理到该刻度时触发
+        };
+        std::unordered_map<quint64, Pending> pending;
+        std::set<std::pair<qint64, quint64>> byDue;
+        std::vector<quint64> ids;
+        const auto forget = [&pending, &byDue](quint64 id) {
+            auto it = pending.find(id);
+            if (it == pending.end()) {
+                return false;
+            }
+            byDue.erase({it->second.dueTick, id});
+            pending.erase(it);
+            return true;
+        };
+        const auto anyId = [&ids, &uniform]() {
+            return ids[static_cast<size_t>(uniform(0, static_cast<qint64>(ids.size()) - 1))];
+        };
+
+        ToastTimerWheel wheel(Resolution);
+        qint64 now = 0;
+        qint64 nextTick = 0; ///< 时间轮下一个待处理的刻度，早于它的截止时间在该刻度触发
+        qint64 fired = 0;
+        qint64 mismatches = 0;
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < operations; i++) {
+            const qint64 action = uniform(0, 9);
+            if (action < 5) {
+                quint64 id = 0;
+                if (action == 0 && !ids.empty()) {
+                    id = anyId();
+                } else {
+                    id = ids.size() + 1;
+                    ids.push_back(id);
+                }
+                const qint64 horizon = Horizons[static_cast<size_t>(uniform(0, 3))];
+                const qint64 deadline = now + uniform(-5000, horizon);
+                const qint64 tick = deadline <= 0 ? 0 : (deadline + Resolution - 1) / Resolution;
+                forget(id);
+                wheel.add(id, deadline);
+                pending[id] = {deadline, std::max(tick, nextTick)};
+                byDue.insert({std::max(tick, nextTick), id});
+            } else if (action < 7) {
+                if (!ids.empty()) {
+                    const quint64 id = anyId();
+                    if (wheel.cancel(id) != forget(id)) {
+                        mismatches++;
+                    }
+                }
+            } else {
+                // 大多是不足一个刻度到数个刻度的小步，偶尔跨越数小时以触发逐层下移
+                now += action == 9 && uniform(0, 9) == 0 ? uniform(0, 2 * 60 * 60 * 1000)
+                                                         : uniform(0, 3 * Resolution);
+                const std::vector<quint64> expired = wheel.advance(now);
+                const qint64 currentTick = now / Resolution;
+                qint64 previousDue = 0;
+                for (const quint64 id : expired) {
+                    auto it = pending.find(id);
+                    if (it == pending.end() || it->second.deadline > now
+                        || it->second.dueTick > currentTick || it->second.dueTick < previousDue) {
+                        mismatches++;
+                    }
+                    if (it != pending.end()) {
+                        previousDue = it->second.dueTick;
+                        forget(id);
+                    }
+                }
+                fired += static_cast<qint64>(expired.size());
+                // 到期刻度已处理却没有触发的条目
+                while (!byDue.empty() && byDue.begin()->first <= currentTick) {
+                    pending.erase(byDue.begin()->second);
+                    byDue.erase(byDue.begin());
+                    mismatches++;
+                }
+                nextTick = std::max(nextTick, currentTick + 1);
+            }
+        }
+        if (wheel.size() != static_cast<int>(pending.size())) {
+            mismatches++;
+        }
+        const qint64 total = timer.nsecsElapsed();
+
+        QJsonObject result;
+        result.insert(QStringLiteral("name"), QStringLiteral("timerWheel.reference"));
+        result.insert(QStringLiteral("iterations"), operations);
+        result.insert(QStringLiteral("unit"), QStringLiteral("ns"));
+        result.insert(
+            QStringLiteral("mean"), static_cast<double>(total) / static_cast<double>(operations));
+        result.insert(QStringLiteral("total"), total);
+        result.insert(QStringLiteral("fired"), fired);
+        result.insert(QStringLiteral("mismatches"), mismatches);
+        m_results.append(result);
+        if (mismatches > 0) {
+            qWarning() << "Timer wheel disagreed with the reference" << mismatches << "times";
+            m_checksFailed = true;
+        }
+    }
+
+    int m_iterations;
+    int m_schedulerOperations;
+    bool m_budgetExceeded{false};
+    bool m_checksFailed{false};
+    QJsonArray m_results;
+};
+
+int main(int argc, char *argv[])
+{
+    // 默认使用离屏平台，无需显示设备即可在 CI 中运行
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("qt-toast lifecycle benchmark"));
+    parser.addHelpOption();
+    QCommandLineOption outputOption(
+        {QStringLiteral("o"), QStringLiteral("output")},
+        QStringLiteral("Write JSON results to <file> instead of stdout."),
+        QStringLiteral("file"));
+    QCommandLineOption iterationsOption(
+        {QStringLiteral("n"), QStringLiteral("iterations")},
+        QStringLiteral("Iterations per stage (default 100)."),
+        QStringLiteral("count"),
+        QStringLiteral("100"));
+    QCommandLineOption schedulerOption(
+        QStringLiteral("scheduler-ops"),
+        QStringLiteral("Present/complete operations for the scheduler stage (default 1000000)."),
+        QStringLiteral("count"),
+        QStringLiteral("1000000"));
+    parser.addOptions({outputOption, iterationsOption, schedulerOption});
+    parser.process(app);
+
+    ToastBenchmark benchmark(
+        parser.value(iterationsOption).toInt(), parser.value(schedulerOption).toInt());
+    benchmark.run();
+    const QByteArray json = benchmark.report().toJson(QJsonDocument::Indented);
+
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+            qCritical() << "Failed to write benchmark results:" << file.fileName();
+            return 1;
+        }
+        file.write(json);
+    } else {
+        QTextStream(stdout) << json;
+    }
+    if (benchmark.checksFailed()) {
+        return 3;
+    }
+    return benchmark.budgetExceeded() ? 2 : 0;
+}
@@ -10,7 +10,6 @@ int main(int argc, char *argv[])
     QCoreApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
 #endif
     QApplication app(argc, argv);
-    Q_INIT_RESOURCE(resources);
     ToastWindow w;
     {
         auto t = ToastManager::success(